@@ -1,89 +1,230 @@
 #include "tui.h"
+#include "tui_record.h"
+#include "tui_ansi.h"
+#include "tui_remote.h"
+#include "tui_tape.h"
+#include "tui_edit.h"
+#include "tui_log.h"
+#include "tui_color.h"
+#include "tui_fuzzy.h"
+#include "tui_cmd.h"
+#include "tui_job.h"
+#include "tui_chart.h"
+#include "tui_font.h"
+#include "tui_event.h"
+#include "tui_stats.h"
+#include "tui_wrap.h"
+#include "tui_utf8.h"
+#include "tui_tree.h"
+#include "tui_live.h"
+#include "tui_layout.h"
 #include <SDL3/SDL_main.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
 
 /* ── Terminal emulator state ───────────────────────────── */
 
-#define TERM_MAX_LINES 200
+#define TERM_MAX_LINES (1 << 20)      /* scrollback */
 #define TERM_LINE_MAX  256
+#define TERM_HIST      100
+#define TERM_REFLOW    16384          /* stale lines rewrapped per frame */
 
 typedef struct {
-    char    lines[TERM_MAX_LINES][TERM_LINE_MAX];
-    uint8_t colors[TERM_MAX_LINES];
-    int     count;
-    int     scroll;
+    char    **lines;                  /* ring, by line number */
+    uint8_t  *colors;
+    TUI_Wrap *wrap;                   /* line numbers and wrapped rows */
+    int64_t   anchor;                 /* line shown on the bottom row */
+    int       anchor_row;             /* which of its rows that is */
+    int64_t   show;                   /* line to bring to the top, or -1 */
+    int       scroll;                 /* rows below the view, 0 follows */
+    int       drawn;                  /* scroll as of the last draw */
+    int       vis;                    /* output rows at the last draw */
+    int       width;                  /* wrap width at the last draw */
+    char     hist[TERM_HIST][TERM_LINE_MAX];
+    int      nhist;
     TUI_InputState input;
+    TUI_CmdRegistry      *cmds;
+    TUI_JobPool          *pool;
+    TUI_JobToken          jobs;       /* direct jobs such as wc */
+    const TUI_ColorRules *rules;
+    TUI_ColorCache       *hl;
 } TermState;
 
-static void term_init(TermState *ts)
+static void term_commands(TermState *ts);
+static int  term_rows(void *user, int64_t line, int width);
+
+static void term_init(TermState *ts, const TUI_ColorRules *rules,
+                      TUI_JobPool *pool)
 {
     memset(ts, 0, sizeof *ts);
-    tui_input_init(&ts->input, TERM_LINE_MAX - 1);
+    tui_input_init(&ts->input, 0);
+    ts->lines  = calloc(TERM_MAX_LINES, sizeof *ts->lines);
+    ts->colors = calloc(TERM_MAX_LINES, sizeof *ts->colors);
+    ts->wrap   = tui_wrap_new(TERM_MAX_LINES);
+    if (ts->wrap) tui_wrap_measure(ts->wrap, term_rows, ts);
+    ts->show   = -1;
+    ts->pool   = pool;
+    ts->cmds   = tui_cmd_new(pool);
+    ts->rules  = rules;
+    ts->hl     = tui_color_cache_new(1024);
+    if (ts->cmds) term_commands(ts);
+}
+
+static const char *term_line(const TermState *ts, int64_t line)
+{
+    const char *s = ts->lines[line % TERM_MAX_LINES];
+    return s ? s : "";
+}
+
+/* bytes of the wrapped row at s: the whole clusters that fit in tw cells,
+   or one cluster wider than that */
+static int term_row(const char *s, int n, int tw)
+{
+    int w, k = tui_utf8_fit(s, n, tw, NULL);
+    if (k == 0 && n > 0) k = tui_utf8_cluster(s, n, &w);
+    return k;
+}
+
+static int term_rows(void *user, int64_t line, int width)
+{
+    const char *s = term_line(user, line);
+    int n = (int)strlen(s), rows = 1;
+    for (int at = term_row(s, n, width); at < n; rows++)
+        at += term_row(s + at, n - at, width);
+    return rows;
 }
 
 static void term_print(TermState *ts, const char *msg, uint8_t fg)
 {
-    if (ts->count >= TERM_MAX_LINES) {
-        memmove(ts->lines[0], ts->lines[1],
-                (size_t)(TERM_MAX_LINES - 1) * TERM_LINE_MAX);
-        memmove(ts->colors, ts->colors + 1, TERM_MAX_LINES - 1);
-        ts->count = TERM_MAX_LINES - 1;
+    if (!ts->lines || !ts->colors || !ts->wrap) return;
+    size_t len = strlen(msg);
+    if (len > TERM_LINE_MAX - 1) len = TERM_LINE_MAX - 1;
+    /* stored before it is pushed, so the index can measure it */
+    int64_t line = tui_wrap_end(ts->wrap);
+    char **slot = &ts->lines[line % TERM_MAX_LINES];
+    free(*slot);                      /* the line that fell off the top */
+    *slot = malloc(len + 1);
+    if (*slot) {
+        memcpy(*slot, msg, len);
+        (*slot)[len] = '\0';
+    }
+    ts->colors[line % TERM_MAX_LINES] = fg;
+    tui_wrap_push(ts->wrap, (int)len);
+}
+
+static void term_clear(TermState *ts)
+{
+    if (!ts->wrap) return;
+    for (int64_t l = tui_wrap_first(ts->wrap); l < tui_wrap_end(ts->wrap); l++) {
+        free(ts->lines[l % TERM_MAX_LINES]);
+        ts->lines[l % TERM_MAX_LINES] = NULL;
+    }
+    tui_wrap_clear(ts->wrap);
+    ts->scroll = 0;
+}
+
+static void term_free(TermState *ts)
+{
+    term_clear(ts);
+    free(ts->lines);
+    free(ts->colors);
+    tui_wrap_free(ts->wrap);
+}
+
+static void term_remember(TermState *ts, const char *cmd)
+{
+    if (ts->nhist > 0 && strcmp(ts->hist[ts->nhist - 1], cmd) == 0) return;
+    if (ts->nhist >= TERM_HIST) {
+        memmove(ts->hist[0], ts->hist[1],
+                (size_t)(TERM_HIST - 1) * TERM_LINE_MAX);
+        ts->nhist = TERM_HIST - 1;
     }
-    snprintf(ts->lines[ts->count], TERM_LINE_MAX, "%s", msg);
-    ts->colors[ts->count] = fg;
-    ts->count++;
+    snprintf(ts->hist[ts->nhist++], TERM_LINE_MAX, "%s", cmd);
+}
+
+static void term_sink(void *user, const char *line, uint8_t fg)
+{
+    term_print(user, line, fg);
+}
+
+/* background commands and jobs still running */
+static int term_busy(TermState *ts)
+{
+    return (ts->cmds ? tui_cmd_running(ts->cmds) : 0)
+         + SDL_GetAtomicInt(&ts->jobs.pending);
 }
 
 static void term_exec(TermState *ts)
 {
-    char *cmd = ts->input.text;
+    const char *cmd = tui_input_text(&ts->input);
+    term_remember(ts, cmd);
 
-    if (strcmp(cmd, "clear") == 0) {
-        ts->count  = 0;
-        ts->scroll = 0;
-    } else {
-        char prompt[TERM_LINE_MAX];
-        snprintf(prompt, sizeof prompt, "> %s", cmd);
-        term_print(ts, prompt, TUI_GREEN);
-
-        if (strcmp(cmd, "help") == 0) {
-            term_print(ts, "Commands:", TUI_CYAN);
-            term_print(ts, "  help    - Show this help", TUI_CYAN);
-            term_print(ts, "  echo    - Echo text  (echo <msg>)", TUI_CYAN);
-            term_print(ts, "  clear   - Clear terminal", TUI_CYAN);
-            term_print(ts, "  time    - Show SDL ticks", TUI_CYAN);
-            term_print(ts, "  hello   - Greeting", TUI_CYAN);
-            term_print(ts, "  colors  - Show palette", TUI_CYAN);
-            term_print(ts, "  version - Version info", TUI_CYAN);
-        } else if (strncmp(cmd, "echo ", 5) == 0) {
-            term_print(ts, cmd + 5, TUI_WHITE);
-        } else if (strcmp(cmd, "hello") == 0) {
-            term_print(ts, "Hello, World!", TUI_YELLOW);
-        } else if (strcmp(cmd, "time") == 0) {
-            char buf[64];
-            snprintf(buf, sizeof buf, "Ticks: %llu",
-                     (unsigned long long)SDL_GetTicks());
-            term_print(ts, buf, TUI_WHITE);
-        } else if (strcmp(cmd, "colors") == 0) {
-            for (int i = 0; i < TUI_PALETTE_SIZE; i++) {
-                char buf[32];
-                snprintf(buf, sizeof buf, "  Color %2d ########", i);
-                term_print(ts, buf, (uint8_t)i);
-            }
-        } else if (strcmp(cmd, "version") == 0) {
-            term_print(ts, "TUI Demo v1.0", TUI_BRIGHT_MAGENTA);
-        } else if (cmd[0] != '\0') {
-            char buf[TERM_LINE_MAX];
-            snprintf(buf, sizeof buf, "Unknown command: %s", cmd);
-            term_print(ts, buf, TUI_BRIGHT_RED);
-        }
-        ts->scroll = 0;
+    char prompt[TERM_LINE_MAX];
+    snprintf(prompt, sizeof prompt, "> %s", cmd);
+    term_print(ts, prompt, TUI_GREEN);
+    if (!ts->cmds)
+        term_print(ts, "No command registry", TUI_BRIGHT_RED);
+    else if (!tui_cmd_run(ts->cmds, cmd))
+        term_print(ts, SDL_GetError(), TUI_BRIGHT_RED);
+    else
+        tui_cmd_drain(ts->cmds, term_sink, ts);
+    ts->scroll = 0;
+
+    tui_input_clear(&ts->input);
+}
+
+/* Tab: extend the command name to the longest unambiguous prefix, or list
+   the candidates when it cannot be extended */
+static void term_complete(TermState *ts)
+{
+    const char *text = tui_input_text(&ts->input);
+    if (!ts->cmds || strchr(text, ' ')) return;
+
+    const char *names[64];
+    int n = tui_cmd_complete(ts->cmds, text, names, 64);
+    if (n == 0) return;
+    size_t tl = strlen(text), len = tl;
+    if (n <= 64) {            /* sorted, so first and last bound the rest */
+        const char *a = names[0], *b = names[n - 1];
+        for (len = 0; a[len] && a[len] == b[len]; len++) {}
     }
 
-    ts->input.text[0] = '\0';
-    ts->input.cursor   = 0;
-    ts->input.scroll   = 0;
+    if (n == 1 || len > tl) {
+        char buf[TERM_LINE_MAX];
+        snprintf(buf, sizeof buf, "%.*s%s", (int)len, names[0],
+                 n == 1 ? " " : "");
+        tui_input_clear (&ts->input);
+        tui_input_insert(&ts->input, buf, (int)strlen(buf));
+        return;
+    }
+    char line[TERM_LINE_MAX] = "";
+    for (int i = 0; i < n && i < 64; i++) {
+        size_t at = strlen(line);
+        snprintf(line + at, sizeof line - at, "%s  ", names[i]);
+    }
+    term_print(ts, line, TUI_CYAN);
+    ts->scroll = 0;
+}
+
+/* one wrapped row, a clipped run per colour; a cluster takes the colour
+   of its first byte */
+static void term_draw_row(TUI *t, int x, int y, int tw, const char *s,
+                          int n, const uint8_t *fg, uint8_t base)
+{
+    char run[TERM_LINE_MAX];
+    int cx = 0;
+    for (int i = 0, j; i < n && cx < tw; i = j) {
+        uint8_t c = fg ? fg[i] : base;
+        for (j = i; j < n && (fg ? fg[j] : base) == c; ) {
+            int w;
+            j += tui_utf8_cluster(s + j, n - j, &w);
+        }
+        memcpy(run, s + i, (size_t)(j - i));
+        run[j - i] = '\0';
+        cx += tui_puts_clip(t, x + cx, y, tw - cx, run, c, TUI_BLACK);
+    }
 }
 
 static void term_draw(TUI *t, TermState *ts,
@@ -99,36 +240,135 @@ static void term_draw(TUI *t, TermState *ts,
     int tl = (int)strlen(title);
     tui_puts(t, x + (w - tl) / 2, y, title, TUI_BRIGHT_WHITE, TUI_BLACK);
 
-    /* layout: top border | output area | separator | input | bottom border */
-    int vis = h - 4;
+    /* layout: top border | output area | separator | input | bottom border;
+       long lines wrap, leaving the last column to the scroll marks */
+    int vis = h - 4, tw = w - 3;
+    ts->vis = vis;
+    TUI_Wrap *wr = ts->wrap;
+    if (!wr) return;
+    tui_wrap_set_width(wr, tw);
+    if (ts->width > 0 && ts->width != tw)      /* keep the same text */
+        ts->anchor_row = (int)((int64_t)ts->anchor_row * ts->width / tw);
+    ts->width = tw;
+    int64_t first = tui_wrap_first(wr), end = tui_wrap_end(wr);
 
-    int max_scroll = ts->count > vis ? ts->count - vis : 0;
-    if (ts->scroll > max_scroll) ts->scroll = max_scroll;
-    if (ts->scroll < 0) ts->scroll = 0;
+    /* the view is kept as the line on its bottom row, so it stays put
+       while new output arrives and while the width changes */
+    if (ts->show >= first && ts->show < end) {
+        tui_wrap_reflow(wr, ts->show, ts->show + vis, 0);
+        uint64_t bottom = tui_wrap_row_of(wr, ts->show) + (uint64_t)vis - 1;
+        ts->anchor = tui_wrap_line_at(wr, bottom, &ts->anchor_row);
+        ts->scroll = ts->drawn = 1;
+    } else if (ts->scroll <= 0 || ts->anchor >= end) {
+        ts->scroll = 0;
+    } else {
+        if (ts->anchor < first) {
+            ts->anchor     = first;
+            ts->anchor_row = 0;
+        }
+        /* move by what was scrolled since the last draw */
+        int d = ts->scroll - (ts->drawn > 0 ? ts->drawn : 0);
+        if (ts->drawn <= 0) {
+            ts->anchor     = end - 1;
+            ts->anchor_row = tui_wrap_line_rows(wr, end - 1) - 1;
+        }
+        while (d > 0) {
+            if (ts->anchor_row >= d) { ts->anchor_row -= d; break; }
+            d -= ts->anchor_row + 1;
+            if (ts->anchor == first) { ts->anchor_row = 0; break; }
+            ts->anchor--;
+            ts->anchor_row = tui_wrap_line_rows(wr, ts->anchor) - 1;
+        }
+        while (d < 0) {
+            int rest = tui_wrap_line_rows(wr, ts->anchor) - 1 - ts->anchor_row;
+            if (rest >= -d) { ts->anchor_row -= d; break; }
+            d += rest + 1;
+            if (++ts->anchor >= end) { ts->scroll = 0; break; }
+            ts->anchor_row = 0;
+        }
+    }
+    ts->show = -1;
+    if (ts->scroll <= 0 && end > first) {
+        ts->anchor     = end - 1;
+        ts->anchor_row = tui_wrap_line_rows(wr, end - 1) - 1;
+    }
+    if (end > first) {
+        int rows = tui_wrap_line_rows(wr, ts->anchor);
+        if (ts->anchor_row >= rows) ts->anchor_row = rows - 1;
+    }
 
-    int first = ts->count - vis - ts->scroll;
-    if (first < 0) first = 0;
+    /* make the rows on screen exact; the rest is rewrapped a slice per
+       frame, newest first */
+    int64_t top = ts->anchor;
+    int above = vis - 1 - ts->anchor_row;          /* rows still to fill */
+    while (end > first && above > 0 && top > first)
+        above -= tui_wrap_line_rows(wr, --top);
+    /* scrolled past the top: move the view down until it is full */
+    while (above > 0 && ts->scroll > 0) {
+        int rest = tui_wrap_line_rows(wr, ts->anchor) - 1 - ts->anchor_row;
+        if (rest > 0) {
+            int k = rest < above ? rest : above;
+            ts->anchor_row += k;
+            above -= k;
+        } else if (ts->anchor + 1 < end) {
+            ts->anchor++;
+            ts->anchor_row = 0;
+            above--;
+        } else {
+            ts->scroll = 0;
+        }
+    }
+    tui_wrap_reflow(wr, top, ts->anchor + 1, TERM_REFLOW);
 
-    for (int i = 0; i < vis; i++) {
-        int li = first + i;
-        if (li >= 0 && li < ts->count) {
-            int max_chars = w - 2;
-            for (int c = 0; c < max_chars && ts->lines[li][c]; c++)
-                tui_putc(t, x + 1 + c, y + 1 + i,
-                         ts->lines[li][c], ts->colors[li], TUI_BLACK);
+    /* bottom up from the anchor; output shorter than the view starts at
+       the top */
+    int64_t li = ts->anchor;
+    int sub = ts->anchor_row;
+    for (int i = vis - 1 - (above > 0 ? above : 0);
+         end > first && i >= 0 && li >= first; i--) {
+        const char *ln = term_line(ts, li);
+        int len = (int)strlen(ln);
+        uint8_t base = ts->colors[li % TERM_MAX_LINES];
+        const uint8_t *fg = ts->hl
+            ? tui_color_cached(ts->hl, ts->rules, (uint64_t)li, ln, len, base)
+            : NULL;
+        int at = 0, n = term_row(ln, len, tw);
+        for (int r = 0; r < sub && at < len; r++) {
+            at += n;
+            n = term_row(ln + at, len - at, tw);
         }
+        term_draw_row(t, x + 1, y + 1 + i, tw, ln + at, n,
+                      fg ? fg + at : NULL, base);
+        if (--sub < 0 && --li >= first)
+            sub = tui_wrap_line_rows(wr, li) - 1;
     }
 
-    /* scroll indicators */
-    if (ts->scroll < max_scroll && max_scroll > 0)
-        tui_putc(t, x + w - 2, y + 1, '^', TUI_YELLOW, TUI_BLACK);
-    if (ts->scroll > 0)
-        tui_putc(t, x + w - 2, y + h - 4, 'v', TUI_YELLOW, TUI_BLACK);
+    /* rows below the view, for the next draw's scrolling and the marks */
+    if (ts->scroll > 0) {
+        uint64_t below = tui_wrap_rows(wr) - tui_wrap_row_of(wr, ts->anchor)
+                       - (uint64_t)ts->anchor_row - 1;
+        ts->scroll = below < INT_MAX ? (int)below : INT_MAX;   /* 0: follow */
+    }
+    ts->drawn = ts->scroll;
+
+    bool more_above = end > first && (top > first || above < 0);
+    tui_scroll_marks(t, x + w - 2, y + 1, vis,
+                     more_above, ts->scroll > 0,
+                     TUI_YELLOW, TUI_BLACK);
 
     /* separator and prompt */
     tui_hline(t, x + 1, y + h - 3, w - 2, '-', TUI_BRIGHT_BLACK, TUI_BLACK);
     tui_puts (t, x + 1, y + h - 2, "> ", TUI_GREEN, TUI_BLACK);
 
+    int busy = term_busy(ts);
+    if (busy > 0) {
+        char msg[48];
+        snprintf(msg, sizeof msg, " %c %d running ",
+                 "|/-\\"[t->now_ms / 100 % 4], busy);
+        tui_puts(t, x + w - 2 - (int)strlen(msg), y + h - 3, msg,
+                 TUI_YELLOW, TUI_BLACK);
+    }
+
     int iw = w - 5;
     if (iw > 2)
         tui_draw_input(t, x + 3, y + h - 2, iw, &ts->input,
@@ -136,6 +376,206 @@ static void term_draw(TUI *t, TermState *ts,
                        TUI_BLACK, TUI_WHITE);
 }
 
+/* ── Terminal commands ─────────────────────────────────── */
+
+static void cmd_help(TUI_CmdCtx *c, int argc, char **argv, void *user)
+{
+    TermState *ts = user;
+    const char *names[64];
+    int n = tui_cmd_complete(ts->cmds, "", names, 64);
+    tui_cmd_print(c, TUI_CYAN, "Commands:");
+    for (int i = 0; i < n && i < 64; i++)
+        tui_cmd_print(c, TUI_CYAN, "  %-7s - %s", names[i],
+                      tui_cmd_help(ts->cmds, names[i]));
+}
+
+static void cmd_echo(TUI_CmdCtx *c, int argc, char **argv, void *user)
+{
+    char buf[TERM_LINE_MAX] = "";
+    for (int i = 1; i < argc; i++) {
+        size_t at = strlen(buf);
+        snprintf(buf + at, sizeof buf - at, i > 1 ? " %s" : "%s", argv[i]);
+    }
+    tui_cmd_print(c, TUI_WHITE, "%s", buf);
+}
+
+static void cmd_clear(TUI_CmdCtx *c, int argc, char **argv, void *user)
+{
+    term_clear(user);               /* synchronous: on the UI thread */
+}
+
+static void cmd_hello(TUI_CmdCtx *c, int argc, char **argv, void *user)
+{
+    tui_cmd_print(c, TUI_YELLOW, "Hello, World!");
+}
+
+static void cmd_time(TUI_CmdCtx *c, int argc, char **argv, void *user)
+{
+    tui_cmd_print(c, TUI_WHITE, "Ticks: %llu",
+                  (unsigned long long)SDL_GetTicks());
+}
+
+static void cmd_colors(TUI_CmdCtx *c, int argc, char **argv, void *user)
+{
+    for (int i = 0; i < TUI_PALETTE_SIZE; i++)
+        tui_cmd_print(c, (uint8_t)i, "  Color %2d ########", i);
+}
+
+static void cmd_version(TUI_CmdCtx *c, int argc, char **argv, void *user)
+{
+    tui_cmd_print(c, TUI_BRIGHT_MAGENTA, "TUI Demo v1.0");
+}
+
+/* the two below run on a worker and report as they go */
+static void cmd_primes(TUI_CmdCtx *c, int argc, char **argv, void *user)
+{
+    long n = argc > 1 ? strtol(argv[1], NULL, 10) : 20000000;
+    if (n < 2) n = 2;
+    long found = 0, step = n / 10 > 0 ? n / 10 : 1;
+    for (long i = 2; i <= n; i++) {
+        bool prime = true;
+        for (long d = 2; d * d <= i; d++)
+            if (i % d == 0) { prime = false; break; }
+        found += prime;
+        if (i % step == 0) {
+            if (tui_cmd_cancelled(c)) return;
+            tui_cmd_print(c, TUI_WHITE, "  %3ld%%  %ld primes <= %ld",
+                          i / step * 10, found, i);
+        }
+    }
+    tui_cmd_print(c, TUI_BRIGHT_GREEN, "%ld primes <= %ld", found, n);
+}
+
+/* numbered lines of varying length, to fill the scrollback */
+static void cmd_seq(TUI_CmdCtx *c, int argc, char **argv, void *user)
+{
+    long n = argc > 1 ? strtol(argv[1], NULL, 10) : 100000;
+    const char *words = "lorem ipsum dolor sit amet consectetur adipiscing "
+                        "elit sed do eiusmod tempor incididunt ut labore et "
+                        "dolore magna aliqua ut enim ad minim veniam quis "
+                        "nostrud exercitation ullamco laboris nisi ut aliquip";
+    int wl = (int)strlen(words);
+    for (long i = 1; i <= n; i++) {
+        if (i % 4096 == 0 && tui_cmd_cancelled(c)) return;
+        int len = (int)(i * 37 % wl);
+        tui_cmd_print(c, TUI_WHITE, "%8ld %.*s", i, len, words);
+    }
+}
+
+static void cmd_diag(TUI_CmdCtx *c, int argc, char **argv, void *user)
+{
+    const char *checks[] = {"palette", "font atlas", "input queue",
+                            "renderer", "timers", "clipboard"};
+    for (int i = 0; i < 6; i++) {
+        for (int k = 0; k < 8; k++) {
+            if (tui_cmd_cancelled(c)) return;
+            SDL_Delay(50);
+        }
+        tui_cmd_print(c, TUI_WHITE, "  checking %-12s ok", checks[i]);
+    }
+    tui_cmd_print(c, TUI_BRIGHT_GREEN, "diagnostics passed");
+}
+
+/* wc runs as a plain job; its completion prints on the UI thread */
+typedef struct {
+    TermState *ts;
+    uint64_t   lines, bytes;
+    bool       opened;
+    char       path[];
+} WcJob;
+
+static void wc_main(TUI_Job *j, void *user)
+{
+    WcJob *w = user;
+    SDL_IOStream *io = SDL_IOFromFile(w->path, "rb");
+    if (!io) return;
+    w->opened = true;
+    char buf[65536];
+    size_t n;
+    while (!tui_job_cancelled(j) && (n = SDL_ReadIO(io, buf, sizeof buf)) > 0) {
+        w->bytes += n;
+        for (size_t i = 0; i < n; i++) w->lines += buf[i] == '\n';
+    }
+    SDL_CloseIO(io);
+}
+
+static void wc_done(void *user, bool cancelled)
+{
+    WcJob *w = user;
+    char buf[TERM_LINE_MAX];
+    if (cancelled)
+        snprintf(buf, sizeof buf, "wc: %s: cancelled", w->path);
+    else if (!w->opened)
+        snprintf(buf, sizeof buf, "wc: %s: cannot open", w->path);
+    else
+        snprintf(buf, sizeof buf, "%10llu lines %12llu bytes  %s",
+                 (unsigned long long)w->lines,
+                 (unsigned long long)w->bytes, w->path);
+    term_print(w->ts, buf,
+               cancelled || !w->opened ? TUI_BRIGHT_RED : TUI_WHITE);
+    free(w);
+}
+
+static void cmd_wc(TUI_CmdCtx *c, int argc, char **argv, void *user)
+{
+    TermState *ts = user;
+    if (argc < 2) tui_cmd_print(c, TUI_BRIGHT_RED, "usage: wc <file>...");
+    for (int i = 1; i < argc; i++) {
+        size_t n = strlen(argv[i]) + 1;
+        WcJob *w = calloc(1, sizeof *w + n);
+        if (!w) return;
+        w->ts = ts;
+        memcpy(w->path, argv[i], n);
+        if (!ts->pool
+            || !tui_job_submit(ts->pool, wc_main, wc_done, w, &ts->jobs)) {
+            tui_cmd_print(c, TUI_BRIGHT_RED, "wc: no job pool");
+            free(w);
+        }
+    }
+}
+
+static void cmd_jobs(TUI_CmdCtx *c, int argc, char **argv, void *user)
+{
+    TermState *ts = user;
+    if (!ts->pool) {
+        tui_cmd_print(c, TUI_BRIGHT_RED, "no job pool");
+        return;
+    }
+    TUI_JobStats st;
+    tui_job_stats(ts->pool, &st);
+    double done = st.completed ? (double)st.completed : 1.0;
+    tui_cmd_print(c, TUI_CYAN, "%d workers, %d queued, %llu of %llu done"
+                  " (%llu stolen)", st.workers, st.queued,
+                  (unsigned long long)st.completed,
+                  (unsigned long long)st.submitted,
+                  (unsigned long long)st.stolen);
+    tui_cmd_print(c, TUI_CYAN, "  wait: mean %.2f ms  max %.2f ms",
+                  st.wait_us_total / 1e3 / done, st.wait_us_max / 1e3);
+    tui_cmd_print(c, TUI_CYAN, "  run:  mean %.2f ms  max %.2f ms",
+                  st.run_us_total / 1e3 / done, st.run_us_max / 1e3);
+}
+
+static void term_commands(TermState *ts)
+{
+    TUI_CmdRegistry *r = ts->cmds;
+    tui_cmd_register(r, "help",    "Show this help", cmd_help, ts, 0);
+    tui_cmd_register(r, "echo",    "Echo text  (echo <msg>)", cmd_echo, ts, 0);
+    tui_cmd_register(r, "clear",   "Clear terminal", cmd_clear, ts, 0);
+    tui_cmd_register(r, "time",    "Show SDL ticks", cmd_time, ts, 0);
+    tui_cmd_register(r, "hello",   "Greeting", cmd_hello, ts, 0);
+    tui_cmd_register(r, "colors",  "Show palette", cmd_colors, ts, 0);
+    tui_cmd_register(r, "version", "Version info", cmd_version, ts, 0);
+    tui_cmd_register(r, "primes",  "Count primes  (primes [n], background)",
+                     cmd_primes, ts, TUI_CMD_ASYNC);
+    tui_cmd_register(r, "seq",     "Print lines  (seq [n], background)",
+                     cmd_seq, ts, TUI_CMD_ASYNC);
+    tui_cmd_register(r, "diag",    "Slow self-test (background)",
+                     cmd_diag, ts, TUI_CMD_ASYNC);
+    tui_cmd_register(r, "wc",      "Count lines  (wc <file>..., background)",
+                     cmd_wc, ts, 0);
+    tui_cmd_register(r, "jobs",    "Job pool statistics", cmd_jobs, ts, 0);
+}
+
 /* ── Helpers ───────────────────────────────────────────── */
 
 static void sync_text_input(TUI *t, int tab, int field)
@@ -146,17 +586,931 @@ static void sync_text_input(TUI *t, int tab, int field)
         tui_text_input_stop(t);
 }
 
+/* ── Colour rules ──────────────────────────────────────── */
+
+static TUI_ColorRules *demo_rules(bool log)
+{
+    TUI_ColorRules *r = tui_color_rules_new();
+    if (!r) return NULL;
+    if (log) {
+        tui_color_rule(r, "\\d\\d\\d\\d-\\d\\d-\\d\\d[ T]\\d\\d:\\d\\d:\\d\\d"
+                          "(\\.\\d+)?", TUI_CYAN, 0);
+        tui_color_rule(r, "ERROR|FATAL|CRIT(ICAL)?", TUI_BRIGHT_RED, 0);
+        tui_color_rule(r, "WARN(ING)?", TUI_YELLOW, 0);
+        tui_color_rule(r, "INFO", TUI_GREEN, 0);
+        tui_color_rule(r, "DEBUG|TRACE", TUI_BRIGHT_BLACK, 0);
+        tui_color_rule(r, "0x[0-9a-f]+|\\d+(\\.\\d+)?", TUI_BRIGHT_MAGENTA,
+                       TUI_COLOR_ICASE);
+    } else {
+        tui_color_rule(r, "help|echo|clear|time|hello|colors|version",
+                       TUI_BRIGHT_WHITE, 0);
+        tui_color_rule(r, "error|fail(ed)?", TUI_BRIGHT_RED,
+                       TUI_COLOR_ICASE);
+        tui_color_rule(r, "Ticks: \\d+", TUI_BRIGHT_YELLOW, 0);
+    }
+    if (!tui_color_compile(r)) {
+        SDL_Log("Colour rules: %s", SDL_GetError());
+        tui_color_rules_free(r);
+        return NULL;
+    }
+    return r;
+}
+
+/* ── Remote client ─────────────────────────────────────── */
+
+static int run_client(const char *addr)
+{
+    char host[256];
+    snprintf(host, sizeof host, "%s", addr);
+    char *colon = strrchr(host, ':');
+    if (!colon) {
+        SDL_Log("--connect expects host:port");
+        return 1;
+    }
+    *colon = '\0';
+    int port = atoi(colon + 1);
+
+    TUI t;
+    if (!tui_init(&t, "TUI Remote", 900, 560,
+                  "Good Old DOS.ttf", 32.0f, 1)) {
+        SDL_Log("Init failed: %s", SDL_GetError());
+        return 1;
+    }
+    TUI_Remote *r = tui_remote_connect(host, port);
+    if (!r) {
+        SDL_Log("Connect failed: %s", SDL_GetError());
+        tui_destroy(&t);
+        return 1;
+    }
+    tui_text_input_start(&t);
+
+    while (t.running) {
+        SDL_Event e;
+        while (SDL_PollEvent(&e)) {
+            if (e.type == SDL_EVENT_QUIT) t.running = false;
+            tui_remote_send_event(r, &e);
+        }
+        tui_begin(&t);
+        if (!tui_remote_update(r, &t)) t.running = false;
+        tui_end(&t);
+    }
+
+    tui_remote_free(r);
+    tui_destroy(&t);
+    return 0;
+}
+
+/* ── Tape player ───────────────────────────────────────── */
+
+static int run_player(const char *path)
+{
+    TUI t;
+    if (!tui_init(&t, "TUI Player", 900, 560,
+                  "Good Old DOS.ttf", 32.0f, 1)) {
+        SDL_Log("Init failed: %s", SDL_GetError());
+        return 1;
+    }
+    TUI_TapePlayer *p = tui_tape_load(path);
+    if (!p) {
+        SDL_Log("Load failed: %s", SDL_GetError());
+        tui_destroy(&t);
+        return 1;
+    }
+
+    uint64_t dur  = tui_tape_duration(p);
+    uint64_t base = SDL_GetTicks();          /* wall time of tape time 0 */
+    uint64_t pos  = 0;
+    bool paused   = false;
+
+    while (t.running) {
+        SDL_Event e;
+        while (tui_poll_event(&t, &e)) {
+            if (e.type == SDL_EVENT_QUIT) t.running = false;
+            if (e.type != SDL_EVENT_KEY_DOWN) continue;
+            switch (e.key.key) {
+            case SDLK_ESCAPE: t.running = false;          break;
+            case SDLK_SPACE:  paused = !paused;           break;
+            case SDLK_LEFT:   pos = pos > 5000 ? pos - 5000 : 0; break;
+            case SDLK_RIGHT:  pos += 5000;                break;
+            case SDLK_HOME:   pos = 0;                    break;
+            case SDLK_END:    pos = dur;                  break;
+            default: break;
+            }
+            base = SDL_GetTicks() - pos;
+        }
+        if (!paused) pos = SDL_GetTicks() - base;
+        if (pos > dur) pos = dur;
+        base = SDL_GetTicks() - pos;
+        tui_tape_seek(p, pos);
+
+        char title[96];
+        snprintf(title, sizeof title, "TUI Player  %llu.%01llus / %llu.%01llus%s",
+                 (unsigned long long)(pos / 1000),
+                 (unsigned long long)(pos % 1000 / 100),
+                 (unsigned long long)(dur / 1000),
+                 (unsigned long long)(dur % 1000 / 100),
+                 paused ? "  [paused]" : "");
+        SDL_SetWindowTitle(t.window, title);
+
+        tui_begin(&t);
+        tui_tape_blit(p, &t);
+        tui_end(&t);
+    }
+
+    tui_tape_free(p);
+    tui_destroy(&t);
+    return 0;
+}
+
+/* ── Editor ────────────────────────────────────────────── */
+
+static int run_editor(const char *path)
+{
+    TUI t;
+    if (!tui_init(&t, "TUI Editor", 900, 560,
+                  "Good Old DOS.ttf", 32.0f, 1)) {
+        SDL_Log("Init failed: %s", SDL_GetError());
+        return 1;
+    }
+    TUI_Editor *ed = tui_editor_open(path);
+    if (!ed) {
+        SDL_Log("Open failed: %s", SDL_GetError());
+        tui_destroy(&t);
+        return 1;
+    }
+    tui_text_input_start(&t);
+
+    char status[64] = "";
+    while (t.running) {
+        SDL_Event e;
+        while (tui_poll_event(&t, &e)) {
+            if (e.type == SDL_EVENT_QUIT) t.running = false;
+            if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_ESCAPE) {
+                t.running = false;
+            } else if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_S
+                       && (e.key.mod & SDL_KMOD_CTRL)) {
+                snprintf(status, sizeof status, "%s",
+                         tui_editor_save(ed, path) ? "Saved"
+                                                   : SDL_GetError());
+            } else if (tui_editor_handle(ed, &e)) {
+                status[0] = '\0';
+            }
+        }
+
+        tui_begin(&t);
+        tui_draw_editor(&t, 0, 1, t.cols, t.rows - 2, ed, true,
+                        TUI_WHITE, TUI_BLACK, TUI_BLACK, TUI_WHITE);
+
+        size_t line, col, lines;
+        tui_editor_position(ed, &line, &col);
+        char total[24] = "?";
+        if (tui_editor_lines(ed, &lines))
+            snprintf(total, sizeof total, "%zu", lines);
+        char title[160];
+        snprintf(title, sizeof title, " %s%s   Ln %zu/%s  Col %zu   %s",
+                 path, tui_editor_modified(ed) ? " *" : "",
+                 line, total, col, status);
+        tui_fill(&t, 0, 0, t.cols, 1, ' ', TUI_BRIGHT_WHITE, TUI_BLUE);
+        tui_puts(&t, 0, 0, title, TUI_BRIGHT_WHITE, TUI_BLUE);
+
+        TUI_LegendItem l[] = {
+            {"^S", "Save"}, {"^Z", "Undo"}, {"^Y", "Redo"}, {"Esc", "Quit"}};
+        tui_draw_legend(&t, l, 4, TUI_BRIGHT_WHITE, TUI_BLUE,
+                        TUI_WHITE, TUI_BRIGHT_BLACK);
+        tui_end(&t);
+    }
+
+    tui_editor_free(ed);
+    tui_destroy(&t);
+    return 0;
+}
+
+/* ── Log viewer ────────────────────────────────────────── */
+
+static int run_log(const char *path)
+{
+    TUI t;
+    if (!tui_init(&t, "TUI Log", 900, 560,
+                  "Good Old DOS.ttf", 32.0f, 1)) {
+        SDL_Log("Init failed: %s", SDL_GetError());
+        return 1;
+    }
+    TUI_LogView *lv = tui_log_open(path);
+    if (!lv) {
+        SDL_Log("Open failed: %s", SDL_GetError());
+        tui_destroy(&t);
+        return 1;
+    }
+    TUI_ColorRules *rules = demo_rules(true);
+    if (rules) tui_log_set_colors(lv, rules);
+
+    TUI_InputState query;
+    tui_input_init(&query, 100);
+    bool searching = false;
+
+    while (t.running) {
+        SDL_Event e;
+        while (tui_poll_event(&t, &e)) {
+            if (e.type == SDL_EVENT_QUIT) t.running = false;
+            if (searching) {
+                if (e.type == SDL_EVENT_KEY_DOWN
+                    && (e.key.key == SDLK_RETURN
+                        || e.key.key == SDLK_ESCAPE)) {
+                    searching = false;
+                    tui_text_input_stop(&t);
+                } else if (tui_input_handle(&query, &e)) {
+                    tui_log_search(lv, tui_input_text(&query));
+                }
+                continue;
+            }
+            if (e.type != SDL_EVENT_KEY_DOWN) continue;
+            if (e.key.key == SDLK_ESCAPE) {
+                t.running = false;
+            } else if (e.key.key == SDLK_SLASH) {
+                searching = true;
+                tui_text_input_start(&t);
+            } else if (e.key.key == SDLK_N) {
+                tui_log_find_next(lv, e.key.mod & SDL_KMOD_SHIFT);
+            } else {
+                tui_log_handle(lv, &e);
+            }
+        }
+
+        tui_begin(&t);
+        tui_draw_log(&t, 0, 1, t.cols, t.rows - 2, lv,
+                     TUI_WHITE, TUI_BLACK, TUI_BLACK, TUI_YELLOW);
+
+        TUI_LogInfo in;
+        tui_log_info(lv, &in);
+        char title[160];
+        snprintf(title, sizeof title, " %s   %llu lines%s%s",
+                 path, (unsigned long long)in.lines,
+                 in.indexed < in.size ? "  (indexing)" : "",
+                 in.following ? "  [follow]" : "");
+        tui_fill(&t, 0, 0, t.cols, 1, ' ', TUI_BRIGHT_WHITE, TUI_BLUE);
+        tui_puts(&t, 0, 0, title, TUI_BRIGHT_WHITE, TUI_BLUE);
+
+        if (searching || tui_input_len(&query) > 0) {
+            char hits[48];
+            snprintf(hits, sizeof hits, "%llu match%s%s",
+                     (unsigned long long)in.matches,
+                     in.matches == 1 ? "" : "es",
+                     in.searching ? "..." : "");
+            int hl = (int)strlen(hits);
+            tui_fill(&t, 0, t.rows - 1, t.cols, 1, ' ',
+                     TUI_WHITE, TUI_BRIGHT_BLACK);
+            tui_putc(&t, 0, t.rows - 1, '/', TUI_WHITE, TUI_BRIGHT_BLACK);
+            tui_draw_input(&t, 1, t.rows - 1, 32, &query, searching,
+                           TUI_WHITE, TUI_BRIGHT_BLACK,
+                           TUI_BLACK, TUI_WHITE);
+            tui_puts(&t, t.cols - hl - 1, t.rows - 1, hits,
+                     TUI_WHITE, TUI_BRIGHT_BLACK);
+        } else {
+            TUI_LegendItem l[] = {
+                {"/", "Search"}, {"n/N", "Next/Prev"},
+                {"End", "Follow"}, {"Esc", "Quit"}};
+            tui_draw_legend(&t, l, 4, TUI_BRIGHT_WHITE, TUI_BLUE,
+                            TUI_WHITE, TUI_BRIGHT_BLACK);
+        }
+        tui_end(&t);
+    }
+
+    tui_input_free(&query);
+    tui_log_close(lv);
+    tui_color_rules_free(rules);
+    tui_destroy(&t);
+    return 0;
+}
+
+/* ── Tree browser ──────────────────────────────────────── */
+
+/* directories as branches; runs on a worker */
+static SDL_EnumerationResult fs_entry(void *user, const char *dir,
+                                      const char *name)
+{
+    char path[4096];
+    snprintf(path, sizeof path, "%s%s", dir, name);
+    SDL_PathInfo info;
+    bool branch = SDL_GetPathInfo(path, &info)
+               && info.type == SDL_PATHTYPE_DIRECTORY;
+    return tui_tree_list_add(user, name, 0, branch)
+         ? SDL_ENUM_CONTINUE : SDL_ENUM_SUCCESS;
+}
+
+static void fs_load(TUI_TreeList *out, const char *path, uint64_t key,
+                    void *user)
+{
+    SDL_EnumerateDirectory(path, fs_entry, out);
+}
+
+/* ":N" browses a made-up tree, N children per node, eight levels deep;
+   the key is the depth */
+static void synth_load(TUI_TreeList *out, const char *path, uint64_t key,
+                       void *user)
+{
+    int fanout = *(const int *)user;
+    char name[32];
+    for (int i = 0; i < fanout; i++) {
+        snprintf(name, sizeof name, "%s%d", key + 1 < 8 ? "node " : "leaf ",
+                 i);
+        if (!tui_tree_list_add(out, name, key + 1, key + 1 < 8)) return;
+    }
+}
+
+static int run_tree(const char *root)
+{
+    TUI t;
+    if (!tui_init(&t, "TUI Tree", 900, 560,
+                  "Good Old DOS.ttf", 32.0f, 1)) {
+        SDL_Log("Init failed: %s", SDL_GetError());
+        return 1;
+    }
+    int fanout = root[0] == ':' ? atoi(root + 1) : 0;
+    TUI_JobPool *pool = tui_job_pool_new(0);
+    TUI_Tree *tr = fanout > 0
+        ? tui_tree_new(pool, "synthetic", 0, synth_load, &fanout, 0)
+        : tui_tree_new(pool, root, 0, fs_load, NULL, TUI_TREE_SORT);
+    if (!tr) {
+        SDL_Log("Tree failed: %s", SDL_GetError());
+        tui_job_pool_free(pool);
+        tui_destroy(&t);
+        return 1;
+    }
+
+    enum { ID_TREE = 1 };
+    char status[4096 + 16] = "";
+    while (t.running) {
+        SDL_Event e;
+        while (tui_poll_event(&t, &e)) {
+            if (e.type == SDL_EVENT_QUIT) t.running = false;
+            if (tui_mouse_handle(&t, &e)) {
+                const TUI_Mouse *m = &t.mouse;
+                if (m->target < ID_TREE) continue;
+                if (m->wheel) tui_tree_move(tr, -3 * m->wheel);
+                else if (m->click && m->button == SDL_BUTTON_LEFT)
+                    tui_tree_click(tr, m->target - ID_TREE);
+                continue;
+            }
+            if (e.type != SDL_EVENT_KEY_DOWN) continue;
+            if (e.key.key == SDLK_ESCAPE) {
+                t.running = false;
+                continue;
+            }
+            int n = 1 + tui_event_take_repeats(&t, &e);
+            for (int i = 0; i < n; i++) tui_tree_handle(tr, &e);
+        }
+        int picked = tui_tree_confirmed(tr);
+        if (picked >= 0) {
+            int at = snprintf(status, sizeof status, "picked ");
+            tui_tree_path(tr, picked, status + at, (int)sizeof status - at);
+        }
+
+        tui_begin(&t);
+        tui_set_id(&t, ID_TREE);
+        tui_draw_tree(&t, 0, 1, t.cols, t.rows - 3, tr, true,
+                      TUI_WHITE, TUI_BLACK, TUI_BLACK, TUI_CYAN,
+                      TUI_BRIGHT_BLACK);
+        tui_set_id(&t, 0);
+
+        TUI_TreeInfo in;
+        tui_tree_info(tr, &in);
+        char title[160];
+        snprintf(title, sizeof title, " %s   %d nodes, %d rows%s",
+                 fanout > 0 ? root : tui_tree_name(tr, 0), in.nodes, in.rows,
+                 in.loading ? "  (loading)" : "");
+        tui_fill(&t, 0, 0, t.cols, 1, ' ', TUI_BRIGHT_WHITE, TUI_BLUE);
+        tui_puts_clip(&t, 0, 0, t.cols, title, TUI_BRIGHT_WHITE, TUI_BLUE);
+        tui_fill(&t, 0, t.rows - 2, t.cols, 1, ' ', TUI_WHITE, TUI_BLACK);
+        tui_puts_clip(&t, 1, t.rows - 2, t.cols - 2, status,
+                      TUI_YELLOW, TUI_BLACK);
+
+        TUI_LegendItem l[] = {
+            {"Right/Left", "Open/Close"}, {"Enter", "Pick"},
+            {"PgUp/PgDn", "Page"}, {"Esc", "Quit"}};
+        tui_draw_legend(&t, l, 4, TUI_BRIGHT_WHITE, TUI_BLUE,
+                        TUI_WHITE, TUI_BRIGHT_BLACK);
+        tui_end(&t);
+    }
+
+    tui_tree_free(tr);
+    tui_job_pool_free(pool);
+    tui_destroy(&t);
+    return 0;
+}
+
+/* ── Charts demo ───────────────────────────────────────── */
+
+#define CHART_RATE 100000                 /* samples per second */
+
+typedef struct {
+    TUI_Series   *s;
+    SDL_AtomicInt stop;
+} Producer;
+
+/* a slow wave, a faster ripple, noise and rare spikes, at CHART_RATE */
+static int producer_main(void *data)
+{
+    Producer *p = data;
+    float buf[1024];
+    uint64_t start = SDL_GetTicksNS(), done = 0;
+    while (!SDL_GetAtomicInt(&p->stop)) {
+        uint64_t due = (SDL_GetTicksNS() - start) / 1000 * CHART_RATE / 1000000;
+        while (done < due) {
+            int n = due - done < 1024 ? (int)(due - done) : 1024;
+            for (int i = 0; i < n; i++) {
+                float ts = (float)((done + (uint64_t)i) % (CHART_RATE * 3600))
+                         / CHART_RATE;
+                buf[i] = 50 + 25 * SDL_sinf(ts * 0.4f) + 8 * SDL_sinf(ts * 9)
+                       + 6 * SDL_randf()
+                       + (SDL_randf() < 0.00002f ? 30 : 0);
+            }
+            tui_series_push_n(p->s, buf, n);
+            done += (uint64_t)n;
+        }
+        SDL_Delay(5);
+    }
+    return 0;
+}
+
+static int run_charts(void)
+{
+    TUI t;
+    if (!tui_init(&t, "TUI Charts", 900, 560,
+                  "Good Old DOS.ttf", 32.0f, 1)) {
+        SDL_Log("Init failed: %s", SDL_GetError());
+        return 1;
+    }
+    TUI_Series *s = tui_series_new(1 << 23);          /* ~80 s */
+    TUI_Chart *spark = tui_chart_new(s, TUI_CHART_SPARK, CHART_RATE);
+    TUI_Chart *bars  = tui_chart_new(s, TUI_CHART_BARS, 10 * CHART_RATE);
+    TUI_Chart *line  = tui_chart_new(s, TUI_CHART_LINE, 60 * CHART_RATE);
+    Producer prod = {s, {0}};
+    SDL_Thread *th = s && spark && bars && line
+        ? SDL_CreateThread(producer_main, "chart_producer", &prod) : NULL;
+    if (!th) {
+        SDL_Log("Charts failed: %s", SDL_GetError());
+        t.running = false;
+    }
+
+    int secs = 60;
+    uint64_t frames = 0, redrawn = 0, start = SDL_GetTicks();
+    while (t.running) {
+        SDL_Event e;
+        while (tui_poll_event(&t, &e)) {
+            if (e.type == SDL_EVENT_QUIT) t.running = false;
+            if (e.type != SDL_EVENT_KEY_DOWN) continue;
+            if (e.key.key == SDLK_ESCAPE) t.running = false;
+            else if (e.key.key == SDLK_LEFT && secs < 60) secs *= 2;
+            else if (e.key.key == SDLK_RIGHT && secs > 1) secs /= 2;
+            if (secs > 60) secs = 60;
+            tui_chart_set_window(line, (uint64_t)secs * CHART_RATE);
+        }
+
+        /* the grid is rebuilt every frame; count frames where a chart moved */
+        int w = t.cols - 4;
+        frames++;
+        if (tui_chart_update(spark, w) | tui_chart_update(bars, w)
+            | tui_chart_update(line, w))
+            redrawn++;
+
+        tui_begin(&t);
+        uint64_t n  = tui_series_count(s);
+        double   el = (double)(SDL_GetTicks() - start + 1) / 1000.0;
+        char title[128];
+        snprintf(title, sizeof title,
+                 " TUI Charts   %llu samples (%.0fk/s)   charts changed in "
+                 "%llu of %llu frames",
+                 (unsigned long long)n, n / el / 1000.0,
+                 (unsigned long long)redrawn, (unsigned long long)frames);
+        tui_fill(&t, 0, 0, t.cols, 1, ' ', TUI_BRIGHT_WHITE, TUI_BLUE);
+        tui_puts(&t, 0, 0, title, TUI_BRIGHT_WHITE, TUI_BLUE);
+
+        int y  = 2;
+        int bh = (t.rows - 10) / 2 > 2 ? (t.rows - 10) / 2 : 2;
+        int lh = t.rows - 9 - bh > 2 ? t.rows - 9 - bh : 2;
+        tui_puts(&t, 2, y++, "Last second, peak per column", TUI_CYAN, TUI_BLACK);
+        tui_draw_chart(&t, 2, y++, w, 1, spark, TUI_BRIGHT_GREEN, TUI_BLACK);
+        y++;
+        tui_puts(&t, 2, y++, "Last 10 s, peak per column", TUI_CYAN, TUI_BLACK);
+        tui_draw_chart(&t, 2, y, w, bh, bars, TUI_YELLOW, TUI_BLACK);
+        y += bh + 1;
+        char label[64];
+        snprintf(label, sizeof label, "Last %d s, min to max per column", secs);
+        tui_puts(&t, 2, y++, label, TUI_CYAN, TUI_BLACK);
+        tui_draw_chart(&t, 2, y, w, lh, line, TUI_BRIGHT_CYAN, TUI_BLACK);
+
+        TUI_LegendItem l[] = {{"</>", "Zoom"}, {"Esc", "Quit"}};
+        tui_draw_legend(&t, l, 2, TUI_BRIGHT_WHITE, TUI_BLUE,
+                        TUI_WHITE, TUI_BRIGHT_BLACK);
+        tui_end(&t);
+    }
+
+    if (th) {
+        SDL_SetAtomicInt(&prod.stop, 1);
+        SDL_WaitThread(th, NULL);
+    }
+    tui_chart_free(spark);
+    tui_chart_free(bars);
+    tui_chart_free(line);
+    tui_series_free(s);
+    tui_destroy(&t);
+    return 0;
+}
+
+/* ── Live table demo ───────────────────────────────────── */
+
+#define LIVE_ROWS  1000
+#define LIVE_FEEDS 4
+#define LIVE_RATE  1000000                /* updates per second, all feeds */
+
+typedef struct {
+    TUI_Live     *lt;
+    int           id;
+    SDL_AtomicInt stop;
+    SDL_AtomicInt *sent;
+} Feed;
+
+static const char *live_cols[] = {"Symbol", "Bid", "Ask", "Last", "Volume"};
+
+/* random walks of the rows id, id + LIVE_FEEDS, ..., at its share of
+   LIVE_RATE; a full queue is waited out */
+static int feed_main(void *data)
+{
+    Feed *f = data;
+    int n = (LIVE_ROWS - f->id + LIVE_FEEDS - 1) / LIVE_FEEDS;
+    double *px = malloc((size_t)n * sizeof *px);
+    double *vol = calloc((size_t)n, sizeof *vol);
+    if (!px || !vol) { free(px); free(vol); return 1; }
+    Uint64 rng = 0x9e3779b97f4a7c15ull * (Uint64)(f->id + 1);
+    for (int i = 0; i < n; i++) px[i] = 10 + SDL_randf_r(&rng) * 490;
+
+    uint64_t start = SDL_GetTicksNS(), done = 0;
+    while (!SDL_GetAtomicInt(&f->stop)) {
+        uint64_t due = (SDL_GetTicksNS() - start) / 1000
+                     * (LIVE_RATE / LIVE_FEEDS) / 1000000;
+        int sent = 0;
+        while (done < due) {
+            int i = SDL_rand_r(&rng, n), row = f->id + i * LIVE_FEEDS;
+            int col = 1 + SDL_rand_r(&rng, 4);
+            double v;
+            if (col == 4) v = vol[i] += 100 * SDL_rand_r(&rng, 10);
+            else {
+                px[i] *= 1 + (SDL_randf_r(&rng) - 0.5f) * 0.0002;
+                v = col == 1 ? px[i] - 0.01 : col == 2 ? px[i] + 0.01 : px[i];
+            }
+            if (!tui_live_post(f->lt, row, col, v)) break;
+            done++;
+            sent++;
+        }
+        SDL_AddAtomicInt(f->sent, sent);
+        SDL_Delay(1);
+    }
+    free(px);
+    free(vol);
+    return 0;
+}
+
+static int run_live(void)
+{
+    TUI t;
+    if (!tui_init(&t, "TUI Live", 900, 560,
+                  "Good Old DOS.ttf", 32.0f, 1)) {
+        SDL_Log("Init failed: %s", SDL_GetError());
+        return 1;
+    }
+    TUI_Live *lt = tui_live_new(LIVE_ROWS, 5, 1 << 16);
+    if (lt) {
+        tui_live_column(lt, 0, live_cols[0], 8, NULL);
+        for (int c = 1; c < 4; c++)
+            tui_live_column(lt, c, live_cols[c], 9, "%.2f");
+        tui_live_column(lt, 4, live_cols[4], 10, "%.0f");
+        for (int r = 0; r < LIVE_ROWS; r++) {
+            char sym[8];
+            snprintf(sym, sizeof sym, "%c%c%c%03d", 'A' + r % 26,
+                     'A' + r / 26 % 26, 'X' + r % 3, r);
+            tui_live_text(lt, r, 0, sym);
+        }
+    }
+
+    SDL_AtomicInt sent = {0};
+    Feed feeds[LIVE_FEEDS];
+    SDL_Thread *th[LIVE_FEEDS] = {0};
+    bool ok = lt != NULL;
+    for (int i = 0; i < LIVE_FEEDS && ok; i++) {
+        feeds[i] = (Feed){lt, i, {0}, &sent};
+        th[i] = SDL_CreateThread(feed_main, "live_feed", &feeds[i]);
+        ok = th[i] != NULL;
+    }
+    if (!ok) {
+        SDL_Log("Live table failed: %s", SDL_GetError());
+        t.running = false;
+    }
+
+    int top = 0, flash = 300;
+    uint64_t start = SDL_GetTicks(), last = start, draw_ns = 0, frames = 0;
+    double rate = 0, ms = 0;
+    while (t.running) {
+        SDL_Event e;
+        int page = t.rows - 8 > 1 ? t.rows - 8 : 1;
+        while (tui_poll_event(&t, &e)) {
+            if (e.type == SDL_EVENT_QUIT) t.running = false;
+            if (e.type != SDL_EVENT_KEY_DOWN) continue;
+            switch (e.key.key) {
+            case SDLK_ESCAPE:   t.running = false; break;
+            case SDLK_UP:       top--; break;
+            case SDLK_DOWN:     top++; break;
+            case SDLK_PAGEUP:   top -= page; break;
+            case SDLK_PAGEDOWN: top += page; break;
+            case SDLK_F:
+                flash = flash ? 0 : 300;
+                tui_live_flash(lt, flash, TUI_GREEN, TUI_RED);
+                break;
+            }
+        }
+        if (top > LIVE_ROWS - page) top = LIVE_ROWS - page;
+        if (top < 0) top = 0;
+
+        tui_begin(&t);
+        uint64_t t0 = SDL_GetTicksNS();
+        tui_draw_live(&t, 1, 2, lt, top, page, TUI_WHITE, TUI_BLACK,
+                      TUI_BRIGHT_WHITE, TUI_BLUE);
+        draw_ns += SDL_GetTicksNS() - t0;
+        frames++;
+
+        /* rates over about half a second */
+        uint64_t now = SDL_GetTicks();
+        if (now - last >= 500) {
+            rate    = SDL_SetAtomicInt(&sent, 0) * 1000.0 / (double)(now - last);
+            ms      = (double)draw_ns / 1e6 / (double)frames;
+            last    = now;
+            draw_ns = frames = 0;
+        }
+        TUI_LiveStats st;
+        tui_live_stats(lt, &st);
+        char title[160];
+        snprintf(title, sizeof title,
+                 " TUI Live   %.0fk updates/s   %.1f%% coalesced   "
+                 "%d of %d cells changed   %.2f ms/frame   %llu dropped",
+                 rate / 1000.0,
+                 st.posted ? 100.0 * st.coalesced / st.posted : 0.0,
+                 st.changed, st.dirty, ms, (unsigned long long)st.dropped);
+        tui_fill(&t, 0, 0, t.cols, 1, ' ', TUI_BRIGHT_WHITE, TUI_BLUE);
+        tui_puts(&t, 0, 0, title, TUI_BRIGHT_WHITE, TUI_BLUE);
+
+        TUI_LegendItem l[] = {{"PgUp/PgDn", "Scroll"}, {"F", "Flash"},
+                              {"Esc", "Quit"}};
+        tui_draw_legend(&t, l, 3, TUI_BRIGHT_WHITE, TUI_BLUE,
+                        TUI_WHITE, TUI_BRIGHT_BLACK);
+        tui_end(&t);
+    }
+
+    for (int i = 0; i < LIVE_FEEDS; i++) {
+        if (!th[i]) continue;
+        SDL_SetAtomicInt(&feeds[i].stop, 1);
+        SDL_WaitThread(th[i], NULL);
+    }
+    tui_live_free(lt);
+    tui_destroy(&t);
+    return 0;
+}
+
+/* ── Consoles ──────────────────────────────────────────── */
+
+#define CONSOLE_MAX 8
+
+/* the console an event belongs to, -1 for a window already closed */
+static int console_of(const TUI *w, int n, const SDL_Event *e)
+{
+    SDL_Window *win = SDL_GetWindowFromEvent(e);
+    if (!win) return 0;                 /* not tied to a window */
+    for (int i = 0; i < n; i++)
+        if (w[i].window == win) return i;
+    return -1;
+}
+
+static int run_consoles(int n, const char *font_path, float font_size,
+                        bool crisp)
+{
+    if (n < 1) n = 1;
+    if (n > CONSOLE_MAX) n = CONSOLE_MAX;
+
+    /* one rasterized atlas for every window */
+    uint64_t t0 = SDL_GetTicksNS();
+    TUI_FontCache *fonts = tui_font_cache_new(font_path, font_size);
+    if (!fonts) {
+        SDL_Log("Init failed: %s", SDL_GetError());
+        return 1;
+    }
+    TUI w[CONSOLE_MAX];
+    int open = 0;
+    for (int i = 0; i < n; i++) {
+        char title[32];
+        snprintf(title, sizeof title, "TUI Console %d", i + 1);
+        if (!tui_init_shared(&w[open], title, 640, 400, fonts, 1)) {
+            SDL_Log("Console %d failed: %s", i + 1, SDL_GetError());
+            continue;
+        }
+        tui_set_native_zoom(&w[open], crisp);
+        open++;
+    }
+    tui_font_cache_free(fonts);             /* the windows hold it now */
+    SDL_Log("consoles: %d windows in %.1f ms", open,
+            (double)(SDL_GetTicksNS() - t0) / 1e6);
+
+    uint64_t frames = 0;
+    while (open > 0) {
+        /* every window's events arrive through the first one, so windows
+           are closed only once its queue is drained */
+        SDL_Event e;
+        bool quit = false, closing[CONSOLE_MAX] = {0};
+        while (tui_poll_event(&w[0], &e)) {
+            if (e.type == SDL_EVENT_QUIT) quit = true;
+            int i = console_of(w, open, &e);
+            if (i < 0 || closing[i]) continue;
+            if (e.type == SDL_EVENT_WINDOW_CLOSE_REQUESTED) {
+                closing[i] = true;
+                continue;
+            }
+            if (e.type != SDL_EVENT_KEY_DOWN) continue;
+            switch (e.key.key) {
+            case SDLK_ESCAPE: quit = true; break;
+            case SDLK_EQUALS: case SDLK_KP_PLUS:
+                tui_set_scale(&w[i], w[i].zoom + 1);
+                break;
+            case SDLK_MINUS: case SDLK_KP_MINUS:
+                tui_set_scale(&w[i], w[i].zoom > 1 ? w[i].zoom - 1 : 1);
+                break;
+            case SDLK_LEFTBRACKET: case SDLK_RIGHTBRACKET: {
+                /* the cache is shared, so every window follows */
+                float size = font_size
+                    + (e.key.key == SDLK_LEFTBRACKET ? -4.0f : 4.0f);
+                if (size >= 8.0f && size <= 96.0f
+                    && tui_set_font(&w[i], font_path, size))
+                    font_size = size;
+                break;
+            }
+            default: break;
+            }
+        }
+        for (int i = open - 1; i >= 0; i--) {
+            if (!closing[i]) continue;
+            tui_destroy(&w[i]);
+            w[i] = w[--open];
+        }
+        if (quit || open == 0) break;
+
+        frames++;
+        for (int i = 0; i < open; i++) {
+            TUI *t = &w[i];
+            tui_begin(t);
+            char title[128];
+            snprintf(title, sizeof title,
+                     " Console %d of %d   %dx%d cells   zoom %d   %g pt%s",
+                     i + 1, open, t->cols, t->rows, t->zoom, font_size,
+                     tui_font_busy(t) ? "   loading" : "");
+            tui_fill(t, 0, 0, t->cols, 1, ' ', TUI_BRIGHT_WHITE, TUI_BLUE);
+            tui_puts(t, 0, 0, title, TUI_BRIGHT_WHITE, TUI_BLUE);
+
+            /* the whole atlas, so a missing upload shows */
+            int x = 2, y = 2;
+            for (int c = 32; c < 127 && y < t->rows - 2; c++) {
+                tui_putc(t, x, y, (char)c, 1 + (c + i) % 15, TUI_BLACK);
+                if (++x >= t->cols - 2) { x = 2; y++; }
+            }
+            for (int k = 1; k <= 8 && y + 1 < t->rows - 2; k++)
+                tui_putc(t, 1 + k, y + 2, TUI_BLOCK(k), TUI_BRIGHT_GREEN,
+                         TUI_BLACK);
+            char line[64];
+            snprintf(line, sizeof line, "frame %llu",
+                     (unsigned long long)frames);
+            if (y + 4 < t->rows - 1)
+                tui_puts(t, 2, y + 4, line, TUI_BRIGHT_BLACK, TUI_BLACK);
+
+            TUI_LegendItem l[] = {
+                {"[/]", "Font"}, {"+/-", "Zoom"}, {"Esc", "Quit"}};
+            tui_draw_legend(t, l, 3, TUI_BRIGHT_WHITE, TUI_BLUE,
+                            TUI_WHITE, TUI_BRIGHT_BLACK);
+            tui_end(t);
+        }
+    }
+
+    for (int i = 0; i < open; i++) tui_destroy(&w[i]);
+    return 0;
+}
+
+/* ── Static layouts ────────────────────────────────────── */
+
+/* the main window's chrome and pages, baked by tui_layout_stamp() */
+
+#define PAGE_TOP 5
+enum { FIELD_TITLE };
+
+static void draw_chrome(TUI *t, TUI_Layout *l, void *user)
+{
+    (void)user;
+    tui_fill(t, 0, 0, t->cols, 1, ' ', TUI_BRIGHT_WHITE, TUI_BLUE);
+    tui_layout_mark(l, FIELD_TITLE, 2, 0, t->cols - 4, 1);
+    tui_hline(t, 0, 3, t->cols, '-', TUI_BRIGHT_BLACK, TUI_BLACK);
+}
+
+static void draw_general(TUI *t, TUI_Layout *l, void *user)
+{
+    (void)l; (void)user;
+    tui_puts(t, 2, PAGE_TOP,     "Name:",   TUI_WHITE, TUI_BLACK);
+    tui_puts(t, 2, PAGE_TOP + 2, "Email:",  TUI_WHITE, TUI_BLACK);
+    tui_puts(t, 2, PAGE_TOP + 4, "Action:", TUI_WHITE, TUI_BLACK);
+}
+
+static void draw_table(TUI *t, TUI_Layout *l, void *user)
+{
+    (void)l; (void)user;
+    static const char *th[] = {"Name", "Age", "City"};
+    static const char *td[] = {
+        "Alice",   "30", "New York",
+        "Bob",     "25", "Los Angeles",
+        "Charlie", "35", "Chicago",
+        "Diana",   "28", "Houston",
+    };
+    tui_draw_table(t, 2, PAGE_TOP, 3, 4, th, td, NULL,
+                   TUI_WHITE, TUI_BLACK, TUI_BRIGHT_WHITE, TUI_BLUE);
+}
+
+static void draw_about(TUI *t, TUI_Layout *l, void *user)
+{
+    (void)l; (void)user;
+    tui_box(t, 1, PAGE_TOP - 1, t->cols - 2, 10, TUI_BRIGHT_BLACK, TUI_BLACK);
+    tui_puts_wrap(t, 3, PAGE_TOP, t->cols - 6,
+        "This is a lightweight character-grid TUI framework "
+        "for SDL3. Everything is rendered as characters on a "
+        "cell grid using a monospace font.\n\n"
+        "Features: text wrapping, ASCII box drawing, "
+        "horizontal and vertical menus, tables, input "
+        "fields, modal dialogs, and a terminal emulator.\n\n"
+        "Navigation is keyboard-driven; the mouse can click "
+        "to focus and scroll with the wheel.",
+        TUI_WHITE, TUI_BLACK);
+}
+
 /* ── Main ──────────────────────────────────────────────── */
 
 int main(int argc, char *argv[])
 {
-    (void)argc; (void)argv;
+    const char *record_path = NULL, *replay_path = NULL, *tape_path = NULL;
+    const char *font_path = "Good Old DOS.ttf";
+    float font_size = 32.0f;
+    bool tty = false, crisp = false;
+    int  serve_port = 0, consoles = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--tty") == 0) tty = true;
+        else if (strcmp(argv[i], "--crisp") == 0) crisp = true;
+        else if (i + 1 < argc && strcmp(argv[i], "--connect") == 0)
+            return run_client(argv[i + 1]);
+        else if (i + 1 < argc && strcmp(argv[i], "--play") == 0)
+            return run_player(argv[i + 1]);
+        else if (i + 1 < argc && strcmp(argv[i], "--edit") == 0)
+            return run_editor(argv[i + 1]);
+        else if (i + 1 < argc && strcmp(argv[i], "--log") == 0)
+            return run_log(argv[i + 1]);
+        else if (i + 1 < argc && strcmp(argv[i], "--tree") == 0)
+            return run_tree(argv[i + 1]);
+        else if (strcmp(argv[i], "--charts") == 0)
+            return run_charts();
+        else if (strcmp(argv[i], "--live") == 0)
+            return run_live();
+        else if (i + 1 < argc && strcmp(argv[i], "--tape") == 0)
+            tape_path = argv[++i];
+        else if (i + 1 < argc && strcmp(argv[i], "--serve") == 0)
+            serve_port = atoi(argv[++i]);
+        else if (i + 1 < argc && strcmp(argv[i], "--record") == 0)
+            record_path = argv[++i];
+        else if (i + 1 < argc && strcmp(argv[i], "--replay") == 0)
+            replay_path = argv[++i];
+        else if (i + 1 < argc && strcmp(argv[i], "--consoles") == 0)
+            consoles = atoi(argv[++i]);
+    }
+    if (consoles > 0)
+        return run_consoles(consoles, font_path, font_size, crisp);
+
     TUI t;
-    if (!tui_init(&t, "TUI Demo", 900, 560,
-                  "Good Old DOS.ttf", 32.0f, 1)) {
+    bool ok = replay_path ? tui_init_headless(&t, 80, 25)
+            : tty         ? tui_init_ansi(&t, 0, 1)
+            : serve_port  ? tui_init_remote(&t, serve_port)
+            : tui_init(&t, "TUI Demo", 900, 560, font_path, font_size, 1);
+    if (!ok) {
         SDL_Log("Init failed: %s", SDL_GetError());
         return 1;
     }
+    if (record_path && !tui_record_start(&t, record_path))
+        SDL_Log("Recording disabled: %s", SDL_GetError());
+    if (replay_path && !tui_replay_start(&t, replay_path)) {
+        SDL_Log("Replay failed: %s", SDL_GetError());
+        tui_destroy(&t);
+        return 1;
+    }
+    tui_set_native_zoom(&t, crisp);
+    TUI_TapeWriter *tape = tape_path ? tui_tape_open(tape_path, 2000) : NULL;
+    if (tape_path && !tape)
+        SDL_Log("Tape disabled: %s", SDL_GetError());
 
     /* ── widget state ──────────────────────────────────── */
     const char *tabs[] = {"General", "Table", "Terminal", "About"};
@@ -174,30 +1528,99 @@ int main(int argc, char *argv[])
 
     TUI_ModalState modal = {0};
 
-    const char *th[] = {"Name", "Age", "City"};
-    const char *td[] = {
-        "Alice",   "30", "New York",
-        "Bob",     "25", "Los Angeles",
-        "Charlie", "35", "Chicago",
-        "Diana",   "28", "Houston",
+    /* static parts of the screen, baked once per grid size */
+    TUI_Layout *chrome = tui_layout_new(draw_chrome, NULL);
+    TUI_Layout *pages[] = {
+        tui_layout_new(draw_general, NULL), tui_layout_new(draw_table, NULL),
+        NULL, tui_layout_new(draw_about, NULL)
     };
+    if (!chrome || !pages[TAB_GENERAL] || !pages[TAB_TABLE]
+        || !pages[TAB_ABOUT]) {
+        SDL_Log("Out of memory");
+        t.running = false;
+    }
 
+    TUI_ColorRules *term_rules = demo_rules(false);
     TermState term;
-    term_init(&term);
+    TUI_JobPool *pool = tui_job_pool_new(0);
+    if (!pool) SDL_Log("Job pool disabled: %s", SDL_GetError());
+    term_init(&term, term_rules, pool);
     term_print(&term, "Welcome to TUI Terminal!", TUI_BRIGHT_CYAN);
     term_print(&term, "Type 'help' for a list of commands.", TUI_CYAN);
 
     bool on_tabs = true;
     int  field   = 0; /* sub-focus inside General tab */
 
+    /* widget ids for mouse hit testing; menus take one per item and the
+       modal one plus one per button */
+    enum {
+        ID_TABS = 1, ID_NAME = ID_TABS + TAB_COUNT, ID_EMAIL,
+        ID_ACTIONS, ID_TERM = ID_ACTIONS + 3, ID_MODAL
+    };
+
+    /* fuzzy finder popup: over tab names, command history or scrollback */
+    enum { FIND_NONE, FIND_TABS, FIND_HISTORY, FIND_SCROLLBACK };
+    const char *find_titles[] = {NULL, " Go to tab ", " History ",
+                                 " Find in output "};
+    const char **find_items = malloc(TERM_MAX_LINES * sizeof *find_items);
+    TUI_Fuzzy *finder = find_items ? tui_fuzzy_new() : NULL;
+    int find = FIND_NONE;
+
     /* ── main loop ─────────────────────────────────────── */
     while (t.running) {
         SDL_Event e;
-        while (SDL_PollEvent(&e)) {
+        while (tui_poll_event(&t, &e)) {
             if (e.type == SDL_EVENT_QUIT) {
                 t.running = false;
                 break;
             }
+            if (pool && tui_job_handle_event(pool, &e)) continue;
+
+            /* ── mouse: click to focus, wheel to scroll ── */
+            if (tui_mouse_handle(&t, &e)) {
+                const TUI_Mouse *m = &t.mouse;
+                int id = m->target;
+                bool left = m->down && m->button == SDL_BUTTON_LEFT;
+                if (modal.active) {
+                    int opt = id - ID_MODAL - 1;
+                    if (opt < 0 || opt >= 2 || m->button != SDL_BUTTON_LEFT)
+                        continue;
+                    modal.selected = opt;
+                    if (m->click) {
+                        modal.result = opt;
+                        modal.active = false;
+                    }
+                    continue;
+                }
+                if (find != FIND_NONE) continue;
+
+                if (m->wheel && id == ID_TERM) {
+                    term.scroll += 3 * m->wheel;    /* clamped when drawn */
+                } else if (m->wheel && id >= ID_ACTIONS && id < ID_TERM) {
+                    act_menu.selected -= m->wheel;
+                    if (act_menu.selected < 0) act_menu.selected = 0;
+                    if (act_menu.selected > 2) act_menu.selected = 2;
+                } else if (left && id >= ID_TABS && id < ID_NAME) {
+                    tab_menu.selected = id - ID_TABS;
+                    on_tabs = false;
+                    field   = 0;
+                    sync_text_input(&t, tab_menu.selected, field);
+                } else if (left && id >= ID_NAME && id < ID_TERM) {
+                    int f = id < ID_ACTIONS ? id - ID_NAME : 2;
+                    /* a second click on the selected action runs it */
+                    bool again = !on_tabs && field == 2 && f == 2
+                              && act_menu.selected == id - ID_ACTIONS;
+                    on_tabs = false;
+                    field   = f;
+                    if (f == 2) act_menu.selected = id - ID_ACTIONS;
+                    if (again) tui_modal_open(&modal, true);
+                    sync_text_input(&t, TAB_GENERAL, field);
+                } else if (left && id == ID_TERM) {
+                    on_tabs = false;
+                    sync_text_input(&t, TAB_TERMINAL, field);
+                }
+                continue;
+            }
 
             /* ── modal captures everything ─────────────── */
             if (modal.active) {
@@ -205,6 +1628,66 @@ int main(int argc, char *argv[])
                 continue;
             }
 
+            /* ── so does the finder ────────────────────── */
+            if (find != FIND_NONE) {
+                tui_fuzzy_handle(finder, &e);
+                int pick = tui_fuzzy_confirmed(finder);
+                if (pick >= 0 && find == FIND_TABS) {
+                    tab_menu.selected = pick;
+                    on_tabs = false;
+                    field   = 0;
+                } else if (pick >= 0 && find == FIND_HISTORY) {
+                    tui_input_clear (&term.input);
+                    tui_input_insert(&term.input, find_items[pick],
+                                     (int)strlen(find_items[pick]));
+                } else if (pick >= 0) {
+                    /* bring the picked line to the top of the output */
+                    term.show = tui_wrap_first(term.wrap) + pick;
+                }
+                if (pick >= 0 || tui_fuzzy_escaped(finder)) {
+                    find = FIND_NONE;
+                    if (on_tabs) tui_text_input_stop(&t);
+                    else sync_text_input(&t, tab_menu.selected, field);
+                }
+                continue;
+            }
+
+            /* ── Ctrl-R / Ctrl-F in the terminal, letters on the tab bar */
+            if (finder && e.type == SDL_EVENT_KEY_DOWN) {
+                bool ctrl = e.key.mod & SDL_KMOD_CTRL;
+                int n = 0;
+                if (on_tabs && !ctrl && !(e.key.mod & SDL_KMOD_ALT)
+                    && e.key.key >= SDLK_A && e.key.key <= SDLK_Z) {
+                    for (n = 0; n < TAB_COUNT; n++) find_items[n] = tabs[n];
+                    find = FIND_TABS;
+                } else if (!on_tabs && ctrl
+                           && tab_menu.selected == TAB_TERMINAL
+                           && e.key.key == SDLK_R) {
+                    for (n = 0; n < term.nhist; n++)    /* newest first */
+                        find_items[n] = term.hist[term.nhist - 1 - n];
+                    find = FIND_HISTORY;
+                } else if (!on_tabs && ctrl
+                           && tab_menu.selected == TAB_TERMINAL
+                           && e.key.key == SDLK_F) {
+                    int64_t l = tui_wrap_first(term.wrap);
+                    while (l < tui_wrap_end(term.wrap))
+                        find_items[n++] = term_line(&term, l++);
+                    find = FIND_SCROLLBACK;
+                }
+                if (find != FIND_NONE) {
+                    if (!tui_fuzzy_set(finder, find_items, n)) {
+                        find = FIND_NONE;
+                        continue;
+                    }
+                    if (find == FIND_TABS) {
+                        char seed[2] = {(char)e.key.key, '\0'};
+                        tui_fuzzy_query(finder, seed);
+                    }
+                    tui_text_input_start(&t);
+                    continue;
+                }
+            }
+
             /* ── zoom (+/-) when not in a text field ───── */
             bool typing = !on_tabs
                 && ((tab_menu.selected == TAB_GENERAL && field < 2)
@@ -213,12 +1696,22 @@ int main(int argc, char *argv[])
             if (!typing && e.type == SDL_EVENT_KEY_DOWN) {
                 if (e.key.key == SDLK_EQUALS
                     || e.key.key == SDLK_KP_PLUS) {
-                    tui_set_scale(&t, t.scale + 1);
+                    tui_set_scale(&t, t.zoom + 1);
                     continue;
                 }
                 if (e.key.key == SDLK_MINUS
                     || e.key.key == SDLK_KP_MINUS) {
-                    tui_set_scale(&t, t.scale > 1 ? t.scale - 1 : 1);
+                    tui_set_scale(&t, t.zoom > 1 ? t.zoom - 1 : 1);
+                    continue;
+                }
+                /* font size: rasterized in the background */
+                if (e.key.key == SDLK_LEFTBRACKET
+                    || e.key.key == SDLK_RIGHTBRACKET) {
+                    float size = font_size
+                        + (e.key.key == SDLK_LEFTBRACKET ? -4.0f : 4.0f);
+                    if (size >= 8.0f && size <= 96.0f
+                        && tui_set_font(&t, font_path, size))
+                        font_size = size;
                     continue;
                 }
             }
@@ -279,19 +1772,36 @@ int main(int argc, char *argv[])
                 if (e.type == SDL_EVENT_KEY_DOWN) {
                     if (e.key.key == SDLK_RETURN
                         || e.key.key == SDLK_KP_ENTER) {
-                        if (term.input.text[0] != '\0')
+                        if (tui_input_len(&term.input) > 0)
                             term_exec(&term);
                         break;
                     }
+                    if (e.key.key == SDLK_TAB) {
+                        term_complete(&term);
+                        break;
+                    }
+                    if (e.key.key == SDLK_C
+                        && (e.key.mod & SDL_KMOD_CTRL)) {
+                        if (term_busy(&term) > 0) {
+                            if (term.cmds) tui_cmd_cancel(term.cmds);
+                            tui_job_cancel(&term.jobs);
+                            term_print(&term, "^C", TUI_BRIGHT_RED);
+                        }
+                        break;
+                    }
+                    /* held keys: apply the queued repeats at once */
+                    int n = 1 + tui_event_take_repeats(&t, &e);
                     if (e.key.key == SDLK_PAGEUP) {
-                        term.scroll += 5;
+                        term.scroll += 5 * n;
                         break;
                     }
                     if (e.key.key == SDLK_PAGEDOWN) {
-                        term.scroll -= 5;
+                        term.scroll -= 5 * n;
                         if (term.scroll < 0) term.scroll = 0;
                         break;
                     }
+                    tui_input_handle_n(&term.input, &e, n);
+                    break;
                 }
                 tui_input_handle(&term.input, &e);
                 break;
@@ -302,94 +1812,108 @@ int main(int argc, char *argv[])
             }
         }
 
+        /* completions (the tty and remote backends post no SDL events)
+           and output streamed by background commands */
+        if (pool) tui_job_pump(pool);
+        if (term.cmds) tui_cmd_drain(term.cmds, term_sink, &term);
+
         /* ── draw ──────────────────────────────────────── */
         tui_begin(&t);
 
-        /* title bar */
-        tui_fill(&t, 0, 0, t.cols, 1, ' ',
-                 TUI_BRIGHT_WHITE, TUI_BLUE);
-        {
-            char title[64];
-            snprintf(title, sizeof title, "TUI Demo  (scale %d)", t.scale);
-            tui_puts(&t, 2, 0, title, TUI_BRIGHT_WHITE, TUI_BLUE);
+        /* title bar, separator and the page's labels and borders */
+        tui_layout_stamp(&t, chrome);
+        if (pages[tab_menu.selected])
+            tui_layout_stamp(&t, pages[tab_menu.selected]);
+        SDL_Rect tr;
+        if (tui_layout_field(chrome, FIELD_TITLE, &tr)) {
+            char title[80];
+            snprintf(title, sizeof title, "TUI Demo  (zoom %d, %g pt%s)",
+                     t.zoom, font_size,
+                     tui_font_busy(&t)  ? ", loading"
+                     : tui_font_error(&t) ? ", font failed" : "");
+            tui_puts_clip(&t, tr.x, tr.y, tr.w, title,
+                          TUI_BRIGHT_WHITE, TUI_BLUE);
         }
 
         /* tab bar + separator */
+        tui_set_id(&t, ID_TABS);
         tui_draw_menu_h(&t, 2, 2, tabs, TAB_COUNT, &tab_menu,
                         on_tabs,
                         TUI_WHITE, TUI_BLACK,
                         TUI_BRIGHT_WHITE, TUI_BLUE);
-        tui_hline(&t, 0, 3, t.cols, '-', TUI_BRIGHT_BLACK, TUI_BLACK);
+        tui_set_id(&t, 0);
 
-        int cy = 5;
+        int cy = PAGE_TOP;
 
         switch (tab_menu.selected) {
 
         case TAB_GENERAL: {
-            tui_puts(&t, 2, cy, "Name:", TUI_WHITE, TUI_BLACK);
+            tui_set_id(&t, ID_NAME);
             tui_draw_input(&t, 10, cy, 30, &inp_name,
                            !on_tabs && field == 0,
                            TUI_WHITE, TUI_BLACK,
                            TUI_BLACK, TUI_WHITE);
             cy += 2;
 
-            tui_puts(&t, 2, cy, "Email:", TUI_WHITE, TUI_BLACK);
+            tui_set_id(&t, ID_EMAIL);
             tui_draw_input(&t, 10, cy, 30, &inp_email,
                            !on_tabs && field == 1,
                            TUI_WHITE, TUI_BLACK,
                            TUI_BLACK, TUI_WHITE);
             cy += 2;
 
-            tui_puts(&t, 2, cy++, "Action:", TUI_WHITE, TUI_BLACK);
+            cy++;
+            tui_set_id(&t, ID_ACTIONS);
             tui_draw_menu_v(&t, 2, cy, 20, actions, 3, &act_menu,
                             !on_tabs && field == 2,
                             TUI_WHITE, TUI_BLACK,
                             TUI_BRIGHT_WHITE, TUI_BLUE);
+            tui_set_id(&t, 0);
             break;
         }
 
-        case TAB_TABLE:
-            tui_draw_table(&t, 2, cy, 3, 4, th, td, NULL,
-                           TUI_WHITE, TUI_BLACK,
-                           TUI_BRIGHT_WHITE, TUI_BLUE);
-            break;
-
         case TAB_TERMINAL: {
             int tw = t.cols - 2;
             int th2 = t.rows - cy - 2; /* leave room for legend */
             if (th2 < 6) th2 = 6;
+            tui_set_id(&t, ID_TERM);
             term_draw(&t, &term, 1, cy, tw, th2, !on_tabs);
+            tui_set_id(&t, 0);
             break;
         }
 
-        case TAB_ABOUT:
-            tui_box(&t, 1, cy - 1, t.cols - 2, 10,
-                    TUI_BRIGHT_BLACK, TUI_BLACK);
-            tui_puts_wrap(&t, 3, cy, t.cols - 6,
-                "This is a lightweight character-grid TUI framework "
-                "for SDL3. Everything is rendered as characters on a "
-                "cell grid using a monospace font.\n\n"
-                "Features: text wrapping, ASCII box drawing, "
-                "horizontal and vertical menus, tables, input "
-                "fields, modal dialogs, and a terminal emulator.\n\n"
-                "All navigation is keyboard-driven.",
-                TUI_WHITE, TUI_BLACK);
-            break;
         }
 
         /* modal overlay */
         const char *mopts[] = {"Yes", "No"};
+        tui_set_id(&t, ID_MODAL);
         tui_draw_modal(&t, "Confirm", "Execute this action?",
                        mopts, 2, &modal,
                        TUI_WHITE, TUI_BRIGHT_BLACK,
                        TUI_BRIGHT_WHITE, TUI_BLUE);
+        tui_set_id(&t, 0);
+
+        /* finder overlay */
+        if (find != FIND_NONE) {
+            int fw = t.cols - 4 < 60 ? t.cols - 4 : 60;
+            int fh = t.rows - 4 < 16 ? t.rows - 4 : 16;
+            tui_draw_fuzzy(&t, (t.cols - fw) / 2, (t.rows - fh) / 2,
+                           fw, fh, finder, find_titles[find],
+                           TUI_WHITE, TUI_BRIGHT_BLACK,
+                           TUI_BRIGHT_WHITE, TUI_BLUE, TUI_BRIGHT_YELLOW);
+        }
 
         /* context-sensitive legend bar */
         {
             uint8_t kf = TUI_BRIGHT_WHITE, kb = TUI_BLUE;
             uint8_t df = TUI_WHITE, db = TUI_BRIGHT_BLACK;
 
-            if (modal.active) {
+            if (find != FIND_NONE) {
+                TUI_LegendItem l[] = {
+                    {"Up/Dn", "Select"}, {"Enter", "Pick"},
+                    {"Esc", "Cancel"}};
+                tui_draw_legend(&t, l, 3, kf, kb, df, db);
+            } else if (modal.active) {
                 if (modal.enforce) {
                     TUI_LegendItem l[] = {
                         {"</>", "Switch"}, {"Enter", "Confirm"}};
@@ -403,8 +1927,8 @@ int main(int argc, char *argv[])
             } else if (on_tabs) {
                 TUI_LegendItem l[] = {
                     {"</>", "Tab"}, {"Enter", "Open"},
-                    {"+/-", "Zoom"}};
-                tui_draw_legend(&t, l, 3, kf, kb, df, db);
+                    {"A-Z", "Find"}, {"+/-", "Zoom"}, {"[/]", "Font"}};
+                tui_draw_legend(&t, l, 5, kf, kb, df, db);
             } else {
                 switch (tab_menu.selected) {
                 case TAB_GENERAL: {
@@ -416,9 +1940,12 @@ int main(int argc, char *argv[])
                 }
                 case TAB_TERMINAL: {
                     TUI_LegendItem l[] = {
-                        {"Enter", "Run"}, {"PgUp/Dn", "Scroll"},
+                        {"Enter", "Run"}, {"Tab", "Complete"},
+                        {"C-R", "History"}, {"C-F", "Find"},
                         {"Esc", "Back"}};
-                    tui_draw_legend(&t, l, 3, kf, kb, df, db);
+                    if (term_busy(&term) > 0)
+                        l[2] = (TUI_LegendItem){"C-C", "Cancel"};
+                    tui_draw_legend(&t, l, 5, kf, kb, df, db);
                     break;
                 }
                 default: {
@@ -431,10 +1958,85 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (tape) tui_tape_frame(tape, &t);
         tui_end(&t);
     }
 
+    if (tape) {
+        TUI_TapeStats ts;
+        tui_tape_close(tape, &ts);
+        SDL_Log("tape: %llu frames (%llu key, %llu unchanged, %llu dropped), "
+                "%llu bytes",
+                (unsigned long long)ts.frames, (unsigned long long)ts.keyframes,
+                (unsigned long long)ts.skipped, (unsigned long long)ts.dropped,
+                (unsigned long long)ts.bytes);
+    }
+
+    int rc = 0;
+    TUI_AnsiStats as;
+    tui_ansi_stats(&t, &as);
+    TUI_RemoteStats rs;
+    tui_remote_stats(&t, &rs);
+    if (rs.frames) {
+        SDL_Log("remote: %llu frames (%llu skipped), %.1f bytes/frame "
+                "(%.1f uncoded)",
+                (unsigned long long)rs.frames, (unsigned long long)rs.skipped,
+                rs.bytes_sent / (double)rs.frames,
+                rs.bytes_raw / (double)rs.frames);
+        if (rs.acks)
+            SDL_Log("round trip: min %.2f ms  mean %.2f ms  max %.2f ms",
+                    rs.rtt_us_min / 1e3,
+                    rs.rtt_us_total / 1e3 / (double)rs.acks,
+                    rs.rtt_us_max / 1e3);
+    }
+    TUI_Stats st;
+    if (tui_stats(&t, &st)) {
+        double n = (double)st.frames;
+        SDL_Log("per frame (last %d): %.0f cells written, %.0f changed, "
+                "%.0f draw calls, %.0f colour mods, %.0f bytes uploaded, "
+                "%.1f allocs", st.frames,
+                st.window.cells_written / n, st.window.cells_changed / n,
+                st.window.draw_calls / n, st.window.color_mods / n,
+                st.window.upload_bytes / n, st.window.allocs / n);
+    }
+    if (replay_path) {
+        TUI_ReplayReport rp;
+        tui_replay_report(&t, &rp);
+        SDL_Log("replay: %llu frames, %llu events, %.3f ms wall",
+                (unsigned long long)rp.frames,
+                (unsigned long long)rp.events, rp.wall_ns / 1e6);
+        if (rp.frames)
+            SDL_Log("build: min %.1f us  mean %.1f us  max %.1f us",
+                    rp.build_ns_min / 1e3,
+                    rp.build_ns_total / 1e3 / (double)rp.frames,
+                    rp.build_ns_max / 1e3);
+        if (rp.mismatches) {
+            SDL_Log("MISMATCH: %llu frames differ, first at frame %lld",
+                    (unsigned long long)rp.mismatches,
+                    (long long)rp.first_mismatch);
+            rc = 2;
+        }
+    }
+
+    tui_fuzzy_free(finder);
+    free(find_items);
+    tui_cmd_free(term.cmds);
+    tui_job_cancel(&term.jobs);       /* a long wc or cat stops at once */
+    tui_job_pool_free(pool);          /* runs the last completions */
+    tui_input_free(&term.input);
+    term_free(&term);
+    tui_color_cache_free(term.hl);
+    tui_color_rules_free(term_rules);
+    tui_input_free(&inp_name);
+    tui_input_free(&inp_email);
+    tui_layout_free(chrome);
+    for (int i = 0; i < TAB_COUNT; i++) tui_layout_free(pages[i]);
     tui_destroy(&t);
-    return 0;
+    if (tty && as.frames)
+        SDL_Log("tty: %llu frames, %.1f bytes/frame, %.2f writes/frame",
+                (unsigned long long)as.frames,
+                as.bytes_total / (double)as.frames,
+                as.syscalls_total / (double)as.frames);
+    return rc;
 }
 
@@ -0,0 +1,89 @@
+/* Event pump ordering: text typed through the tty must not be merged
+ * across the key presses between its runs, and escape sequences must
+ * come out as single keys.
+ *
+ *   make test
+ */
+#include "../tui.h"
+#include "../tui_ansi.h"
+#include "../tui_event.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+static int failed;
+
+static void expect(bool ok, const char *what)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        failed++;
+    }
+}
+
+/* feed input through a pipe and describe what tui_poll_event hands out:
+   "T:text" for text, "K:code" for key presses, up to the EOF */
+static void run(const char *name, const char *input, const char *want)
+{
+    int fd[2];
+    if (pipe(fd) != 0) {
+        expect(false, "pipe");
+        return;
+    }
+    if (write(fd[1], input, strlen(input)) != (ssize_t)strlen(input))
+        expect(false, "write");
+    close(fd[1]);
+    int out = open("/dev/null", O_WRONLY);
+
+    TUI t;
+    if (!tui_init_ansi(&t, fd[0], out)) {
+        expect(false, "tui_init_ansi");
+        return;
+    }
+    char got[256] = "";
+    size_t len = 0;
+    bool quit = false;
+    for (int frame = 0; frame < 100 && !quit; frame++) {
+        SDL_Event e;
+        while (tui_poll_event(&t, &e)) {
+            if (e.type == SDL_EVENT_QUIT) { quit = true; break; }
+            if (e.type == SDL_EVENT_TEXT_INPUT)
+                len += (size_t)snprintf(got + len, sizeof got - len,
+                                        "T:%s ", e.text.text);
+            else if (e.type == SDL_EVENT_KEY_DOWN && e.key.mod)
+                len += (size_t)snprintf(got + len, sizeof got - len,
+                                        "K:%x/%x ", (unsigned)e.key.key,
+                                        (unsigned)e.key.mod);
+            else if (e.type == SDL_EVENT_KEY_DOWN)
+                len += (size_t)snprintf(got + len, sizeof got - len,
+                                        "K:%x ", (unsigned)e.key.key);
+        }
+    }
+    tui_destroy(&t);
+    close(fd[0]);
+    close(out);
+
+    if (strcmp(got, want) != 0) {
+        printf("FAIL: %s\n  got  %s\n  want %s\n", name, got, want);
+        failed++;
+    }
+}
+
+int main(void)
+{
+    /* commands typed and entered one after the other */
+    run("commands", "ls\rpwd\r", "T:ls K:d T:pwd K:d ");
+    /* an edit in the middle of typing stays in between */
+    run("backspace", "ab\x7f" "c", "T:ab K:8 T:c ");
+    run("tab, arrow", "x\ty\x1b[Dz", "T:x K:9 T:y K:40000050 T:z ");
+    /* modified keys carry xterm's modifier parameter; sequences that mean
+       nothing here are dropped whole instead of leaking into the text */
+    run("modified keys", "a\x1b[1;5Ab\x1b[3;2~c",
+        "T:a K:40000052/c0 T:b K:7f/3 T:c ");
+    run("unknown csi", "a\x1b[200~b\x1b[?1;2cc\x1b[1;3Hd",
+        "T:abc K:4000004a/300 T:d ");
+
+    printf(failed ? "%d failed\n" : "ok\n", failed);
+    return failed != 0;
+}
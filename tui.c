@@ -1,8 +1,17 @@
 #include "tui.h"
+#include "tui_record.h"
+#include "tui_ansi.h"
+#include "tui_remote.h"
+#include "tui_font.h"
+#include "tui_event.h"
+#include "tui_stats.h"
+#include "tui_utf8.h"
 #include <SDL3/SDL_keycode.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include "tui_alloc.h"
 
 /* ── Default VGA palette ───────────────────────────────── */
 
@@ -17,52 +26,21 @@ static const SDL_Color default_pal[TUI_PALETTE_SIZE] = {
     { 85, 255, 255, 255}, {255, 255, 255, 255},
 };
 
-/* ── Atlas (printable ASCII 32..126) ───────────────────── */
+/* ── Atlas ─────────────────────────────────────────────── */
 
-static bool create_atlas(TUI *t)
+/* atlas slot of a cell character, or -1 for nothing to draw */
+static int glyph_slot(unsigned char v)
 {
-    SDL_Color white = {255, 255, 255, 255};
-    char buf[2] = "M";
-
-    SDL_Surface *ref = TTF_RenderText_Blended(t->font, buf, 0, white);
-    if (!ref) return false;
-    SDL_PixelFormat fmt = ref->format;
-    SDL_DestroySurface(ref);
-
-    int count = 95;
-    SDL_Surface *atlas = SDL_CreateSurface(
-        t->cell_w * count, t->cell_h, fmt);
-    if (!atlas) return false;
-    SDL_FillSurfaceRect(atlas, NULL,
-                        SDL_MapSurfaceRGBA(atlas, 0, 0, 0, 0));
-
-    for (int i = 0; i < count; i++) {
-        buf[0] = (char)(32 + i);
-        SDL_Surface *g = TTF_RenderText_Blended(t->font, buf, 0, white);
-        if (g) {
-            SDL_SetSurfaceBlendMode(g, SDL_BLENDMODE_NONE);
-            SDL_Rect d = {i * t->cell_w, 0, g->w, g->h};
-            SDL_BlitSurface(g, NULL, atlas, &d);
-            SDL_DestroySurface(g);
-        }
-    }
-
-    t->atlas = SDL_CreateTextureFromSurface(t->renderer, atlas);
-    SDL_DestroySurface(atlas);
-    if (!t->atlas) return false;
-    SDL_SetTextureBlendMode(t->atlas, SDL_BLENDMODE_BLEND);
-    SDL_SetTextureScaleMode(t->atlas, SDL_SCALEMODE_NEAREST);
-    return true;
+    if (v >= 32 && v <= 126) return v - 32;
+    if (v >= (unsigned char)TUI_BLOCK(1) && v <= (unsigned char)TUI_BLOCK(8))
+        return TUI_ATLAS_ASCII + v - (unsigned char)TUI_BLOCK(1);
+    return -1;
 }
 
 /* ── Grid resize ───────────────────────────────────────── */
 
-static void resize_grid(TUI *t)
+static void set_grid(TUI *t, int nc, int nr)
 {
-    int w, h;
-    SDL_GetWindowSize(t->window, &w, &h);
-    int nc = w / (t->cell_w * t->scale);
-    int nr = h / (t->cell_h * t->scale);
     if (nc < 1) nc = 1;
     if (nr < 1) nr = 1;
     if (nc != t->cols || nr != t->rows) {
@@ -70,37 +48,63 @@ static void resize_grid(TUI *t)
         t->rows = nr;
         free(t->cells);
         t->cells = calloc((size_t)(nc * nr), sizeof(TUI_Cell));
+        if (t->ids) {
+            free(t->ids);
+            t->ids = calloc((size_t)(nc * nr), sizeof(TUI_Id));
+        }
     }
 }
 
+static void resize_grid(TUI *t)
+{
+    if (t->ansi || t->remote) {
+        int nc = t->cols, nr = t->rows;
+        if (t->ansi) tui_ansi_size  (t, &nc, &nr);
+        else         tui_remote_size(t, &nc, &nr);
+        set_grid(t, nc, nr);
+        return;
+    }
+    if (!t->window) return;   /* headless: grid size is set explicitly */
+    int w, h;
+    SDL_GetWindowSize(t->window, &w, &h);
+    set_grid(t, w / (t->cell_w * t->scale), h / (t->cell_h * t->scale));
+}
+
 /* ── Lifecycle ─────────────────────────────────────────── */
 
 bool tui_init(TUI *t, const char *title, int win_w, int win_h,
               const char *font_path, float font_size, int scale)
 {
     memset(t, 0, sizeof *t);
-    t->scale = scale < 1 ? 1 : scale;
-    memcpy(t->palette, default_pal, sizeof default_pal);
-
-    if (!SDL_Init(SDL_INIT_VIDEO)) return false;
-    if (!TTF_Init())               return false;
+    TUI_FontCache *fonts = tui_font_cache_new(font_path, font_size);
+    if (!fonts) return false;
+    bool ok = tui_init_shared(t, title, win_w, win_h, fonts, scale);
+    /* on failure this drops the last reference, which quits SDL */
+    char err[128];
+    snprintf(err, sizeof err, "%s", ok ? "" : SDL_GetError());
+    tui_font_cache_free(fonts);              /* the window keeps it alive */
+    if (!ok) SDL_SetError("%s", err);
+    return ok;
+}
 
-    t->font = TTF_OpenFont(font_path, font_size);
-    if (!t->font) return false;
+bool tui_init_shared(TUI *t, const char *title, int win_w, int win_h,
+                     TUI_FontCache *fonts, int scale)
+{
+    memset(t, 0, sizeof *t);
+    t->scale = t->zoom = scale < 1 ? 1 : scale;
+    memcpy(t->palette, default_pal, sizeof default_pal);
 
-    TTF_GetStringSize(t->font, "M", 0, &t->cell_w, &t->cell_h);
-    if (t->cell_w <= 0 || t->cell_h <= 0) return false;
+    if (!tui_lib_acquire()) return false;
 
     t->window = SDL_CreateWindow(title, win_w, win_h,
                                  SDL_WINDOW_RESIZABLE);
-    if (!t->window) return false;
+    if (!t->window) goto fail;
 
     t->renderer = SDL_CreateRenderer(t->window, NULL);
-    if (!t->renderer) return false;
+    if (!t->renderer) goto fail;
     SDL_SetRenderVSync(t->renderer, 1);
 
-
-    if (!create_atlas(t)) return false;
+    if (!tui_font_open(t, fonts)) goto fail;
 
     t->cols = win_w / (t->cell_w * t->scale);
     t->rows = win_h / (t->cell_h * t->scale);
@@ -108,6 +112,37 @@ bool tui_init(TUI *t, const char *title, int win_w, int win_h,
     if (t->rows < 1) t->rows = 1;
     t->cells = calloc((size_t)(t->cols * t->rows), sizeof(TUI_Cell));
 
+    t->mouse.x  = t->mouse.y = -1;
+    t->blink_ms = SDL_GetTicks();
+    t->blink_on = true;
+    t->running  = true;
+    return true;
+
+fail:
+    tui_font_close(t);
+    if (t->renderer) SDL_DestroyRenderer(t->renderer);
+    if (t->window)   SDL_DestroyWindow(t->window);
+    t->renderer = NULL;
+    t->window   = NULL;
+    /* releasing the last reference quits SDL, which forgets the error */
+    char err[128];
+    snprintf(err, sizeof err, "%s", SDL_GetError());
+    tui_lib_release();
+    SDL_SetError("%s", err);
+    return false;
+}
+
+bool tui_init_headless(TUI *t, int cols, int rows)
+{
+    memset(t, 0, sizeof *t);
+    t->scale  = t->zoom = 1;
+    t->cell_w = 1;
+    t->cell_h = 1;
+    memcpy(t->palette, default_pal, sizeof default_pal);
+    set_grid(t, cols, rows);
+    if (!t->cells) return false;
+
+    t->mouse.x  = t->mouse.y = -1;
     t->blink_ms = SDL_GetTicks();
     t->blink_on = true;
     t->running  = true;
@@ -116,24 +151,32 @@ bool tui_init(TUI *t, const char *title, int win_w, int win_h,
 
 void tui_destroy(TUI *t)
 {
+    tui_record_stop(t);
+    tui_ansi_close(t);
+    tui_remote_close(t);
+    tui_event_close(t);
+    TUI_STATS_CLOSE(t);
     free(t->cells);
-    if (t->atlas)    SDL_DestroyTexture(t->atlas);
-    if (t->font)     TTF_CloseFont(t->font);
-    TTF_Quit();
+    free(t->ids);
+    tui_font_close(t);
     if (t->renderer) SDL_DestroyRenderer(t->renderer);
-    if (t->window)   SDL_DestroyWindow(t->window);
-    SDL_Quit();
+    if (t->window) {
+        SDL_DestroyWindow(t->window);
+        tui_lib_release();
+    }
 }
 
 void tui_set_scale(TUI *t, int scale)
 {
     if (scale < 1) scale = 1;
+    if (!t->window) return;
     int w, h;
     SDL_GetWindowSize(t->window, &w, &h);
-    int nc = w / (t->cell_w * scale);
-    int nr = h / (t->cell_h * scale);
+    /* a native zoom atlas is about zoom times the size of the base one */
+    int nc = w * t->zoom / (t->cell_w * t->scale * scale);
+    int nr = h * t->zoom / (t->cell_h * t->scale * scale);
     if (nc < 20 || nr < 8) return;   /* reject if grid too small */
-    t->scale = scale;
+    tui_font_zoom(t, scale);
     resize_grid(t);
 }
 
@@ -141,24 +184,41 @@ void tui_set_scale(TUI *t, int scale)
 
 void tui_begin(TUI *t)
 {
+    TUI_STATS_BEGIN(t);
+    tui_event_begin(t);
+    /* one hit test per frame, however many motion events arrived */
+    t->mouse.hover = tui_id_at(t, t->mouse.x, t->mouse.y);
+    tui_font_poll(t);                 /* may change the cell size */
     resize_grid(t);
-    tui_clear(t, TUI_BLACK);
 
     uint64_t now = SDL_GetTicks();
+    int nc = t->cols, nr = t->rows;
+    if (t->rec && tui_record_frame_begin(t, &nc, &nr, &now))
+        set_grid(t, nc, nr);
+    t->now_ms = now;
+    tui_clear(t, TUI_BLACK);
+
     if (now - t->blink_ms >= 500) {
         t->blink_on = !t->blink_on;
         t->blink_ms = now;
     }
 }
 
-void tui_end(TUI *t)
+static void present(TUI *t)
 {
+    if (t->rec && tui_record_frame_end(t)) return;
+    if (t->ansi)   { tui_ansi_present(t);   return; }
+    if (t->remote) { tui_remote_present(t); return; }
+    if (!t->renderer) return;
+
     SDL_SetRenderDrawColor(t->renderer, 0, 0, 0, 255);
     SDL_RenderClear(t->renderer);
+    TUI_COUNT(t, draw_calls, 2);
 
     int s  = t->scale;
     int cw = t->cell_w;
     int ch = t->cell_h;
+    int last_fg = -1;             /* the atlas's colour mod, once set */
 
     for (int r = 0; r < t->rows; r++) {
         for (int c = 0; c < t->cols; c++) {
@@ -172,18 +232,32 @@ void tui_end(TUI *t)
             SDL_Color bg = t->palette[cell->bg % TUI_PALETTE_SIZE];
             SDL_SetRenderDrawColor(t->renderer, bg.r, bg.g, bg.b, 255);
             SDL_RenderFillRect(t->renderer, &dst);
+            TUI_COUNT(t, draw_calls, 2);
 
-            unsigned char v = (unsigned char)cell->ch;
-            if (v >= 32 && v <= 126) {
-                SDL_FRect src = {(float)((v - 32) * cw), 0,
+            int slot = glyph_slot((unsigned char)cell->ch);
+            if (slot >= 0) {
+                SDL_FRect src = {(float)(slot * cw), 0,
                                  (float)cw, (float)ch};
-                SDL_Color fg = t->palette[cell->fg % TUI_PALETTE_SIZE];
-                SDL_SetTextureColorMod(t->atlas, fg.r, fg.g, fg.b);
+                int fi = cell->fg % TUI_PALETTE_SIZE;
+                if (fi != last_fg) {
+                    SDL_Color fg = t->palette[fi];
+                    SDL_SetTextureColorMod(t->atlas, fg.r, fg.g, fg.b);
+                    last_fg = fi;
+                    TUI_COUNT(t, color_mods, 1);
+                }
                 SDL_RenderTexture(t->renderer, t->atlas, &src, &dst);
+                TUI_COUNT(t, draw_calls, 1);
             }
         }
     }
     SDL_RenderPresent(t->renderer);
+    TUI_COUNT(t, draw_calls, 1);
+}
+
+void tui_end(TUI *t)
+{
+    present(t);
+    TUI_STATS_END(t);
 }
 
 /* ── Drawing primitives ────────────────────────────────── */
@@ -193,18 +267,62 @@ void tui_clear(TUI *t, uint8_t bg)
     int n = t->cols * t->rows;
     for (int i = 0; i < n; i++)
         t->cells[i] = (TUI_Cell){' ', TUI_WHITE, bg};
+    TUI_COUNT(t, cells_written, n);
+    if (t->ids) memset(t->ids, 0, (size_t)n * sizeof *t->ids);
 }
 
 void tui_putc(TUI *t, int x, int y, char ch, uint8_t fg, uint8_t bg)
 {
     if (x < 0 || x >= t->cols || y < 0 || y >= t->rows) return;
     t->cells[y * t->cols + x] = (TUI_Cell){ch, fg, bg};
+    TUI_COUNT(t, cells_written, 1);
+    if (t->ids) t->ids[y * t->cols + x] = t->id;
+}
+
+/* n bytes of s in at most cols cells; returns the cells used */
+static int put_text(TUI *t, int x, int y, const char *s, int n, int cols,
+                    uint8_t fg, uint8_t bg)
+{
+    int cx = 0, i = 0;
+    while (i < n && cx < cols) {
+        /* a run of ASCII is cell for byte, but its last byte may carry
+           combining marks */
+        int a = tui_utf8_ascii(s + i, n - i);
+        if (a < n - i && a > 0) a--;
+        if (a > cols - cx) a = cols - cx;
+        for (int k = 0; k < a; k++)
+            tui_putc(t, x + cx++, y, s[i++], fg, bg);
+        if (i >= n || cx >= cols) break;
+
+        int w, len = tui_utf8_cluster(s + i, n - i, &w);
+        if (cx + w > cols) break;
+        unsigned char c = (unsigned char)s[i];
+        if (w > 0) {
+            /* ASCII bases as they are, anything else as '?' */
+            tui_putc(t, x + cx, y, c < 0x80 ? (char)c : '?', fg, bg);
+            for (int k = 1; k < w; k++)
+                tui_putc(t, x + cx + k, y, ' ', fg, bg);
+        }
+        cx += w;
+        i  += len;
+    }
+    return cx;
+}
+
+static int text_width(const char *s)
+{
+    return tui_utf8_width(s, (int)strlen(s));
 }
 
 void tui_puts(TUI *t, int x, int y, const char *s, uint8_t fg, uint8_t bg)
 {
-    for (int i = 0; s[i]; i++)
-        tui_putc(t, x + i, y, s[i], fg, bg);
+    put_text(t, x, y, s, (int)strlen(s), INT_MAX, fg, bg);
+}
+
+int tui_puts_clip(TUI *t, int x, int y, int w, const char *s,
+                  uint8_t fg, uint8_t bg)
+{
+    return w > 0 ? put_text(t, x, y, s, (int)strlen(s), w, fg, bg) : 0;
 }
 
 int tui_puts_wrap(TUI *t, int x, int y, int w, const char *s,
@@ -217,19 +335,22 @@ int tui_puts_wrap(TUI *t, int x, int y, int w, const char *s,
 
         int wl = 0;
         while (s[i + wl] && s[i + wl] != ' ' && s[i + wl] != '\n') wl++;
+        int ww = tui_utf8_width(s + i, wl);
 
-        if (wl > w) {
-            for (int j = 0; j < wl; j++) {
+        if (ww > w) {
+            /* too long for any line: break it between clusters */
+            for (int j = 0; j < wl; ) {
                 if (cx >= w) { cx = 0; cy++; }
-                tui_putc(t, x + cx, y + cy, s[i + j], fg, bg);
-                cx++;
+                int fw, fb = tui_utf8_fit(s + i + j, wl - j, w - cx, &fw);
+                if (fb == 0 && cx > 0) { cx = w; continue; }
+                if (fb == 0) fb = tui_utf8_cluster(s + i + j, wl - j, &fw);
+                cx += put_text(t, x + cx, y + cy, s + i + j, fb, INT_MAX,
+                               fg, bg);
+                j  += fb;
             }
         } else {
-            if (cx > 0 && cx + wl > w) { cx = 0; cy++; }
-            for (int j = 0; j < wl; j++) {
-                tui_putc(t, x + cx, y + cy, s[i + j], fg, bg);
-                cx++;
-            }
+            if (cx > 0 && cx + ww > w) { cx = 0; cy++; }
+            cx += put_text(t, x + cx, y + cy, s + i, wl, INT_MAX, fg, bg);
         }
         i += wl;
         if (s[i] == ' ') {
@@ -274,6 +395,84 @@ void tui_box(TUI *t, int x, int y, int w, int h, uint8_t fg, uint8_t bg)
     tui_vline(t, x + w-1, y + 1, h - 2, '|', fg, bg);
 }
 
+void tui_scroll_marks(TUI *t, int x, int y, int h, bool more_up,
+                      bool more_down, uint8_t fg, uint8_t bg)
+{
+    if (h < 1) return;
+    if (more_up)   tui_putc(t, x, y,         '^', fg, bg);
+    if (more_down) tui_putc(t, x, y + h - 1, 'v', fg, bg);
+}
+
+/* ── Hit testing ───────────────────────────────────────── */
+
+void tui_set_id(TUI *t, TUI_Id id)
+{
+    if (!t->ids) {
+        t->ids = calloc((size_t)(t->cols * t->rows), sizeof *t->ids);
+        if (!t->ids) return;
+    }
+    t->id = id;
+}
+
+TUI_Id tui_id_at(const TUI *t, int x, int y)
+{
+    if (!t->ids || x < 0 || x >= t->cols || y < 0 || y >= t->rows) return 0;
+    return t->ids[y * t->cols + x];
+}
+
+/* items of a menu or dialog get consecutive ids from the current one */
+static void item_id(TUI *t, TUI_Id base, int i)
+{
+    if (base) t->id = (TUI_Id)(base + i);
+}
+
+static void mouse_cell(TUI *t, float px, float py)
+{
+    int cw = t->cell_w * t->scale, ch = t->cell_h * t->scale;
+    t->mouse.x = px < 0 ? -1 : (int)px / cw;
+    t->mouse.y = py < 0 ? -1 : (int)py / ch;
+    if (t->mouse.x >= t->cols || t->mouse.y >= t->rows)
+        t->mouse.x = t->mouse.y = -1;
+}
+
+bool tui_mouse_handle(TUI *t, const SDL_Event *e)
+{
+    TUI_Mouse *m = &t->mouse;
+    switch (e->type) {
+    case SDL_EVENT_MOUSE_MOTION:
+        mouse_cell(t, e->motion.x, e->motion.y);
+        return false;
+    case SDL_EVENT_WINDOW_MOUSE_LEAVE:
+        m->x = m->y = -1;
+        return false;
+    case SDL_EVENT_MOUSE_BUTTON_DOWN:
+    case SDL_EVENT_MOUSE_BUTTON_UP:
+        mouse_cell(t, e->button.x, e->button.y);
+        m->target = tui_id_at(t, m->x, m->y);
+        m->button = e->button.button;
+        m->down   = e->type == SDL_EVENT_MOUSE_BUTTON_DOWN;
+        m->click  = !m->down && m->target && m->target == m->pressed;
+        m->wheel  = 0;
+        if (m->down) m->pressed = m->target;
+        return true;
+    case SDL_EVENT_MOUSE_WHEEL: {
+        mouse_cell(t, e->wheel.mouse_x, e->wheel.mouse_y);
+        float y = e->wheel.direction == SDL_MOUSEWHEEL_FLIPPED
+                ? -e->wheel.y : e->wheel.y;
+        m->wheel_rest += y;
+        m->wheel = (int)m->wheel_rest;
+        m->wheel_rest -= (float)m->wheel;
+        if (m->wheel == 0) return false;
+        m->target = tui_id_at(t, m->x, m->y);
+        m->button = 0;
+        m->down   = m->click = false;
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
 /* ── Menu ──────────────────────────────────────────────── */
 
 void tui_menu_init(TUI_MenuState *s)
@@ -288,6 +487,7 @@ void tui_draw_menu_h(TUI *t, int x, int y,
                      bool focused,
                      uint8_t fg, uint8_t bg, uint8_t sf, uint8_t sb)
 {
+    TUI_Id base = t->id;
     int cx = x;
     for (int i = 0; i < count; i++) {
         bool sel = (i == s->selected);
@@ -295,13 +495,15 @@ void tui_draw_menu_h(TUI *t, int x, int y,
         uint8_t f = highlight ? sf : fg;
         uint8_t b = highlight ? sb : bg;
 
+        item_id(t, base, i);
         tui_putc(t, cx++, y, ' ', f, b);
         tui_puts(t, cx, y, items[i], f, b);
-        cx += (int)strlen(items[i]);
+        cx += text_width(items[i]);
         tui_putc(t, cx++, y, ' ', f, b);
         if (i < count - 1)
             tui_putc(t, cx++, y, ' ', fg, bg);
     }
+    t->id = base;
 }
 
 void tui_draw_menu_v(TUI *t, int x, int y, int w,
@@ -309,10 +511,12 @@ void tui_draw_menu_v(TUI *t, int x, int y, int w,
                      bool focused,
                      uint8_t fg, uint8_t bg, uint8_t sf, uint8_t sb)
 {
+    TUI_Id base = t->id;
     for (int i = 0; i < count; i++) {
         bool sel = (i == s->selected);
         uint8_t f = sel ? sf : fg;
         uint8_t b = sel ? sb : bg;
+        item_id(t, base, i);
         tui_fill(t, x, y + i, w, 1, ' ', f, b);
 
         char marker = ' ';
@@ -325,6 +529,7 @@ void tui_draw_menu_v(TUI *t, int x, int y, int w,
         tui_putc(t, x, y + i, marker, f, b);
         tui_puts(t, x + 2, y + i, items[i], f, b);
     }
+    t->id = base;
 }
 
 bool tui_menu_handle(TUI_MenuState *s, const SDL_Event *e,
@@ -378,9 +583,9 @@ static void tbl_row(TUI *t, int x, int y, int cc, const int *w,
     tui_putc(t, cx++, y, '|', bfg, bg);
     for (int c = 0; c < cc; c++) {
         tui_putc(t, cx++, y, ' ', fg, bg);
-        int slen = (int)strlen(cells[c]);
-        tui_puts(t, cx, y, cells[c], fg, bg);
-        for (int p = slen; p < w[c]; p++)
+        int used = put_text(t, cx, y, cells[c], (int)strlen(cells[c]), w[c],
+                            fg, bg);
+        for (int p = used; p < w[c]; p++)
             tui_putc(t, cx + p, y, ' ', fg, bg);
         cx += w[c];
         tui_putc(t, cx++, y, ' ', fg, bg);
@@ -400,9 +605,9 @@ int tui_draw_table(TUI *t, int x, int y,
 
     for (int c = 0; c < cc; c++) {
         if (col_widths) { widths[c] = col_widths[c]; continue; }
-        widths[c] = (int)strlen(headers[c]);
+        widths[c] = text_width(headers[c]);
         for (int r = 0; r < row_count; r++) {
-            int l = (int)strlen(data[r * cc + c]);
+            int l = text_width(data[r * cc + c]);
             if (l > widths[c]) widths[c] = l;
         }
     }
@@ -419,10 +624,121 @@ int tui_draw_table(TUI *t, int x, int y,
 
 /* ── Input ─────────────────────────────────────────────── */
 
+#define GAP_LEN(s)  ((s)->gap_end - (s)->gap_start)
+#define IS_CONT(c)  (((unsigned char)(c) & 0xc0) == 0x80)
+
 void tui_input_init(TUI_InputState *s, int max_len)
 {
     memset(s, 0, sizeof *s);
-    s->max_len = max_len < TUI_INPUT_MAX ? max_len : TUI_INPUT_MAX - 1;
+    s->max_len = max_len > 0 ? max_len : 0;
+}
+
+void tui_input_free(TUI_InputState *s)
+{
+    free(s->buf);
+    tui_input_init(s, s->max_len);
+}
+
+int tui_input_len(const TUI_InputState *s)
+{
+    return s->cap - GAP_LEN(s);
+}
+
+static char input_at(const TUI_InputState *s, int i)
+{
+    return i < s->gap_start ? s->buf[i] : s->buf[i + GAP_LEN(s)];
+}
+
+static void input_move_gap(TUI_InputState *s, int pos)
+{
+    if (pos < s->gap_start) {
+        int d = s->gap_start - pos;
+        memmove(s->buf + s->gap_end - d, s->buf + pos, (size_t)d);
+        s->gap_start -= d;
+        s->gap_end   -= d;
+    } else if (pos > s->gap_start) {
+        int d = pos - s->gap_start;
+        memmove(s->buf + s->gap_start, s->buf + s->gap_end, (size_t)d);
+        s->gap_start += d;
+        s->gap_end   += d;
+    }
+}
+
+/* make room for n more bytes plus the terminator used by tui_input_text */
+static bool input_reserve(TUI_InputState *s, int n)
+{
+    if (GAP_LEN(s) > n) return true;
+    int len  = tui_input_len(s);
+    int ncap = s->cap ? s->cap * 2 : 64;
+    while (ncap - len <= n) ncap *= 2;
+    char *nb = malloc((size_t)ncap);
+    if (!nb) return false;
+    int tail = s->cap - s->gap_end;
+    if (s->buf) {
+        memcpy(nb, s->buf, (size_t)s->gap_start);
+        memcpy(nb + ncap - tail, s->buf + s->gap_end, (size_t)tail);
+        free(s->buf);
+    }
+    s->buf     = nb;
+    s->gap_end = ncap - tail;
+    s->cap     = ncap;
+    return true;
+}
+
+char *tui_input_text(TUI_InputState *s)
+{
+    if (!input_reserve(s, 0)) return "";
+    input_move_gap(s, tui_input_len(s));
+    s->buf[s->gap_start] = '\0';
+    return s->buf;
+}
+
+void tui_input_clear(TUI_InputState *s)
+{
+    s->gap_start = 0;
+    s->gap_end   = s->cap;
+    s->cursor    = 0;
+    s->scroll    = 0;
+}
+
+void tui_input_insert(TUI_InputState *s, const char *text, int n)
+{
+    if (s->max_len) {
+        int room = s->max_len - tui_input_len(s);
+        if (n > room) {
+            n = room < 0 ? 0 : room;
+            while (n > 0 && IS_CONT(text[n])) n--;   /* whole code points */
+        }
+    }
+    if (n <= 0 || !input_reserve(s, n)) return;
+    input_move_gap(s, s->cursor);
+    memcpy(s->buf + s->gap_start, text, (size_t)n);
+    s->gap_start += n;
+    s->cursor    += n;
+}
+
+static int input_prev(const TUI_InputState *s, int i)
+{
+    if (i <= 0) return 0;
+    do i--; while (i > 0 && IS_CONT(input_at(s, i)));
+    return i;
+}
+
+static int input_next(const TUI_InputState *s, int i)
+{
+    int len = tui_input_len(s);
+    if (i >= len) return len;
+    do i++; while (i < len && IS_CONT(input_at(s, i)));
+    return i;
+}
+
+/* remove bytes [from, to) */
+static void input_delete(TUI_InputState *s, int from, int to)
+{
+    if (to <= from) return;
+    input_move_gap(s, from);
+    s->gap_end += to - from;
+    s->cursor   = from;
 }
 
 void tui_draw_input(TUI *t, int x, int y, int w, TUI_InputState *s,
@@ -432,58 +748,66 @@ void tui_draw_input(TUI *t, int x, int y, int w, TUI_InputState *s,
     int inner = w - 2;
     if (inner < 1) return;
 
-    if (s->cursor < s->scroll) s->scroll = s->cursor;
-    if (s->cursor >= s->scroll + inner) s->scroll = s->cursor - inner + 1;
-    if (s->scroll < 0) s->scroll = 0;
+    /* keep the cursor in view, walking at most one field width */
+    if (s->cursor < s->scroll) {
+        s->scroll = s->cursor;
+    } else {
+        int p = s->cursor;
+        for (int k = 0; p > s->scroll && k < inner - 1; k++)
+            p = input_prev(s, p);
+        if (p > s->scroll) s->scroll = p;
+    }
 
     /* brackets always visible with base colours */
     tui_putc(t, x, y, '[', fg, bg);
     tui_putc(t, x + w - 1, y, ']', fg, bg);
 
-    int slen = (int)strlen(s->text);
+    int len = tui_input_len(s);
+    int ti  = s->scroll;
     for (int i = 0; i < inner; i++) {
-        int ti = s->scroll + i;
-        char ch = (ti < slen) ? s->text[ti] : ' ';
+        char ch = ' ';
+        if (ti < len) {
+            ch = input_at(s, ti);
+            if ((unsigned char)ch >= 0x80) ch = '?';
+        }
         bool at_cur = focused && (ti == s->cursor) && t->blink_on;
         tui_putc(t, x + 1 + i, y, ch,
                  at_cur ? cf : fg,
                  at_cur ? cb : bg);
+        ti = ti < len ? input_next(s, ti) : ti + 1;
     }
 }
 
 bool tui_input_handle(TUI_InputState *s, const SDL_Event *e)
+{
+    return tui_input_handle_n(s, e, 1);
+}
+
+bool tui_input_handle_n(TUI_InputState *s, const SDL_Event *e, int n)
 {
     if (e->type == SDL_EVENT_TEXT_INPUT) {
-        int len = (int)strlen(s->text);
-        int add = (int)strlen(e->text.text);
-        if (len + add <= s->max_len) {
-            memmove(s->text + s->cursor + add,
-                    s->text + s->cursor,
-                    (size_t)(len - s->cursor + 1));
-            memcpy(s->text + s->cursor, e->text.text, (size_t)add);
-            s->cursor += add;
-        }
+        tui_input_insert(s, e->text.text, (int)strlen(e->text.text));
         return true;
     }
     if (e->type != SDL_EVENT_KEY_DOWN) return false;
-    int len = (int)strlen(s->text);
+    int len = tui_input_len(s), p = s->cursor;
     switch (e->key.key) {
-    case SDLK_BACKSPACE:
-        if (s->cursor > 0) {
-            memmove(s->text + s->cursor - 1,
-                    s->text + s->cursor,
-                    (size_t)(len - s->cursor + 1));
-            s->cursor--;
-        }
+    case SDLK_BACKSPACE:                /* a run is deleted in one piece */
+        for (int k = 0; k < n; k++) p = input_prev(s, p);
+        input_delete(s, p, s->cursor);
         return true;
     case SDLK_DELETE:
-        if (s->cursor < len)
-            memmove(s->text + s->cursor,
-                    s->text + s->cursor + 1,
-                    (size_t)(len - s->cursor));
+        for (int k = 0; k < n; k++) p = input_next(s, p);
+        input_delete(s, s->cursor, p);
+        return true;
+    case SDLK_LEFT:
+        for (int k = 0; k < n; k++) p = input_prev(s, p);
+        s->cursor = p;
+        return true;
+    case SDLK_RIGHT:
+        for (int k = 0; k < n; k++) p = input_next(s, p);
+        s->cursor = p;
         return true;
-    case SDLK_LEFT:  if (s->cursor > 0)   s->cursor--; return true;
-    case SDLK_RIGHT: if (s->cursor < len) s->cursor++; return true;
     case SDLK_HOME:  s->cursor = 0;   return true;
     case SDLK_END:   s->cursor = len; return true;
     default: break;
@@ -510,11 +834,11 @@ void tui_draw_modal(TUI *t, const char *title, const char *msg,
 {
     if (!s->active) return;
 
-    int tl = (int)strlen(title);
-    int ml = (int)strlen(msg);
+    int tl = text_width(title);
+    int ml = text_width(msg);
     int ol = 0;
     for (int i = 0; i < count; i++)
-        ol += (int)strlen(options[i]) + 5;
+        ol += text_width(options[i]) + 5;
 
     int iw = tl;
     if (ml > iw) iw = ml;
@@ -537,17 +861,20 @@ void tui_draw_modal(TUI *t, const char *title, const char *msg,
     tui_puts(t, bx + 2, by + 2, msg, fg, bg);
 
     /* option buttons – solid colour, no blink */
+    TUI_Id base = t->id;
     int ox = bx + 2;
     for (int i = 0; i < count; i++) {
         bool sel = (i == s->selected);
         char buf[80];
         snprintf(buf, sizeof buf, "[ %s ]", options[i]);
-        int bl = (int)strlen(buf);
+        int bl = text_width(buf);
+        item_id(t, base, i + 1);
         tui_puts(t, ox, by + bh - 2, buf,
                  sel ? sf : fg,
                  sel ? sb : bg);
         ox += bl + 1;
     }
+    t->id = base;
 }
 
 bool tui_modal_handle(TUI_ModalState *s, const SDL_Event *e, int count)
@@ -584,8 +911,8 @@ void tui_draw_legend(TUI *t, const TUI_LegendItem *items, int count,
     tui_fill(t, 0, y, t->cols, 1, ' ', df, db);
     int cx = 1;
     for (int i = 0; i < count && cx < t->cols; i++) {
-        int kl = (int)strlen(items[i].key);
-        int dl = (int)strlen(items[i].desc);
+        int kl = text_width(items[i].key);
+        int dl = text_width(items[i].desc);
         tui_puts(t, cx, y, items[i].key, kf, kb);
         cx += kl;
         tui_putc(t, cx++, y, ' ', df, db);
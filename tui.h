@@ -20,27 +20,78 @@ enum {
 
 typedef struct { char ch; uint8_t fg, bg; } TUI_Cell;
 
+/* Besides printable ASCII a cell can hold one of eight lower blocks:
+   TUI_BLOCK(1) fills the bottom eighth of the cell, TUI_BLOCK(8) all of it
+   (U+2581..U+2588 on a tty).  They are the control codes 0x11..0x18, so
+   bytes of UTF-8 text drawn as they are never turn into blocks. */
+#define TUI_BLOCK(n) ((char)(0x10 + (n)))
+
+/* ── Widget IDs and mouse ──────────────────────────────── */
+
+/* Application-chosen widget id; 0 is "no widget".  Once tui_set_id() has
+   been called, every cell drawn also records the current id in a plane
+   parallel to the cells, so whatever is drawn last over a cell owns it and
+   overlays hide the widgets below them.  A mouse position resolves to a
+   widget with one array lookup, whatever the number of widgets. */
+typedef uint16_t TUI_Id;
+
+typedef struct {
+    int    x, y;          /* cell under the pointer, -1 when outside */
+    TUI_Id hover;         /* widget under the pointer in the last frame */
+    /* the event tui_mouse_handle() last returned true for */
+    TUI_Id target;        /* widget under it */
+    TUI_Id pressed;       /* widget the latest press landed on */
+    int    button;        /* SDL_BUTTON_LEFT ..., 0 for the wheel */
+    bool   down;          /* a press */
+    bool   click;         /* a release over the widget that was pressed */
+    int    wheel;         /* whole wheel steps, positive away from the user */
+    float  wheel_rest;    /* fraction carried to the next wheel event */
+} TUI_Mouse;
+
 /* ── Context ───────────────────────────────────────────── */
 
+typedef struct TUI_Record TUI_Record;
+typedef struct TUI_Ansi   TUI_Ansi;
+typedef struct TUI_Remote TUI_Remote;
+typedef struct TUI_Fonts  TUI_Fonts;
+typedef struct TUI_FontCache TUI_FontCache;
+typedef struct TUI_Events TUI_Events;
+typedef struct TUI_StatsState TUI_StatsState;
+
 typedef struct {
     SDL_Window   *window;
     SDL_Renderer *renderer;
     TTF_Font     *font;
     SDL_Texture  *atlas;
-    int           cell_w, cell_h;
-    int           scale;
+    int           cell_w, cell_h;   /* of the atlas being drawn */
+    int           scale;            /* its magnification */
+    int           zoom;             /* as set by tui_set_scale */
     int           cols, rows;
     TUI_Cell     *cells;
+    TUI_Id       *ids;        /* widget per cell, once tui_set_id is used */
+    TUI_Id        id;         /* stamped by the drawing primitives */
+    TUI_Mouse     mouse;
     SDL_Color     palette[TUI_PALETTE_SIZE];
     bool          running;
+    uint64_t      now_ms;     /* this frame's time, as recorded on replay */
     uint64_t      blink_ms;
     bool          blink_on;
+    TUI_Record   *rec;        /* active recording / replay, or NULL */
+    TUI_Ansi     *ansi;       /* tty backend instead of the window */
+    TUI_Remote   *remote;     /* frames streamed to a remote client */
+    TUI_Fonts    *fonts;      /* this window's atlases (tui_font.h) */
+    TUI_Events   *events;     /* batched, merged input (tui_poll_event) */
+    TUI_StatsState *stats;    /* frame counters, with TUI_STATS only */
 } TUI;
 
 /* ── Lifecycle ─────────────────────────────────────────── */
 
 bool tui_init   (TUI *t, const char *title, int win_w, int win_h,
                  const char *font_path, float font_size, int scale);
+/* a window drawing with a font cache shared with other windows */
+bool tui_init_shared(TUI *t, const char *title, int win_w, int win_h,
+                     TUI_FontCache *fonts, int scale);
+bool tui_init_headless(TUI *t, int cols, int rows);
 void tui_destroy(TUI *t);
 void tui_set_scale(TUI *t, int scale);
 
@@ -53,14 +104,34 @@ void tui_end  (TUI *t);
 
 void tui_clear    (TUI *t, uint8_t bg);
 void tui_putc     (TUI *t, int x, int y, char ch, uint8_t fg, uint8_t bg);
+/* strings are UTF-8 laid out by grapheme cluster (tui_utf8.h); a cluster
+   with no glyph in the atlas is drawn as '?' padded to its width */
 void tui_puts     (TUI *t, int x, int y, const char *s, uint8_t fg, uint8_t bg);
 int  tui_puts_wrap(TUI *t, int x, int y, int w, const char *s,
                    uint8_t fg, uint8_t bg);
+/* at most w cells of s, whole clusters only; returns the cells used */
+int  tui_puts_clip(TUI *t, int x, int y, int w, const char *s,
+                   uint8_t fg, uint8_t bg);
 void tui_hline    (TUI *t, int x, int y, int w, char ch, uint8_t fg, uint8_t bg);
 void tui_vline    (TUI *t, int x, int y, int h, char ch, uint8_t fg, uint8_t bg);
 void tui_fill     (TUI *t, int x, int y, int w, int h, char ch,
                    uint8_t fg, uint8_t bg);
 void tui_box      (TUI *t, int x, int y, int w, int h, uint8_t fg, uint8_t bg);
+/* '^' at the top / 'v' at the bottom of column x when there is more */
+void tui_scroll_marks(TUI *t, int x, int y, int h, bool more_up,
+                      bool more_down, uint8_t fg, uint8_t bg);
+
+/* ── Hit testing ───────────────────────────────────────── */
+
+/* stamp id into the cells drawn from now on; menus stamp id + i on item
+   i and a modal stamps id + 1 + i on button i, so reserve enough ids */
+void   tui_set_id(TUI *t, TUI_Id id);
+/* widget at a cell as of the last finished frame */
+TUI_Id tui_id_at (const TUI *t, int x, int y);
+/* Feed every event.  Motion only records the position, and hover is
+   resolved once per frame in tui_begin.  Returns true for presses,
+   releases and wheel steps, described by t->mouse. */
+bool   tui_mouse_handle(TUI *t, const SDL_Event *e);
 
 /* ── Menu ──────────────────────────────────────────────── */
 
@@ -95,20 +166,28 @@ int tui_draw_table(TUI *t, int x, int y,
 
 /* ── Text input field ──────────────────────────────────── */
 
-#define TUI_INPUT_MAX 256
-
+/* Gap buffer: text lives in buf[0, gap_start) + buf[gap_end, cap).
+   cursor and scroll are byte offsets on code-point boundaries. */
 typedef struct {
-    char text[TUI_INPUT_MAX];
-    int  cursor, scroll, max_len;
+    char *buf;
+    int   cap, gap_start, gap_end;
+    int   cursor, scroll, max_len;    /* max_len in bytes, 0 = unbounded */
 } TUI_InputState;
 
-void tui_input_init  (TUI_InputState *s, int max_len);
-void tui_draw_input  (TUI *t, int x, int y, int w, TUI_InputState *s,
-                      bool focused, uint8_t fg, uint8_t bg,
-                      uint8_t cur_fg, uint8_t cur_bg);
-bool tui_input_handle(TUI_InputState *s, const SDL_Event *e);
-void tui_text_input_start(TUI *t);
-void tui_text_input_stop (TUI *t);
+void  tui_input_init  (TUI_InputState *s, int max_len);
+void  tui_input_free  (TUI_InputState *s);
+int   tui_input_len   (const TUI_InputState *s);
+char *tui_input_text  (TUI_InputState *s);
+void  tui_input_clear (TUI_InputState *s);
+void  tui_input_insert(TUI_InputState *s, const char *text, int n);
+void  tui_draw_input  (TUI *t, int x, int y, int w, TUI_InputState *s,
+                       bool focused, uint8_t fg, uint8_t bg,
+                       uint8_t cur_fg, uint8_t cur_bg);
+bool  tui_input_handle(TUI_InputState *s, const SDL_Event *e);
+/* the same key pressed n times, e.g. with tui_event_take_repeats() */
+bool  tui_input_handle_n(TUI_InputState *s, const SDL_Event *e, int n);
+void  tui_text_input_start(TUI *t);
+void  tui_text_input_stop (TUI *t);
 
 /* ── Modal dialog ──────────────────────────────────────── */
 
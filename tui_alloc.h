@@ -0,0 +1,24 @@
+#ifndef TUI_ALLOC_H
+#define TUI_ALLOC_H
+
+/*
+ * Included by the library's sources after <stdlib.h>.  With TUI_STATS
+ * their malloc, calloc and realloc calls are counted for tui_stats(); the
+ * application's are not.  Without it this header is empty.
+ */
+
+#ifdef TUI_STATS
+#include <stddef.h>
+
+void *tui_stats_malloc (size_t n);
+void *tui_stats_calloc (size_t n, size_t size);
+void *tui_stats_realloc(void *p, size_t n);
+
+#ifndef TUI_ALLOC_IMPL                  /* defined by tui_stats.c */
+#define malloc(n)     tui_stats_malloc(n)
+#define calloc(n, s)  tui_stats_calloc(n, s)
+#define realloc(p, n) tui_stats_realloc(p, n)
+#endif
+#endif
+
+#endif /* TUI_ALLOC_H */
@@ -0,0 +1,534 @@
+#define _POSIX_C_SOURCE 200809L
+#include "tui_ansi.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "tui_alloc.h"
+
+#ifndef _WIN32
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define FRAME_MS   16
+#define ECH_MIN    8      /* blank runs at least this long use ECH */
+
+struct TUI_Ansi {
+    int            fd_in, fd_out;
+    struct termios saved;
+    bool           raw;
+
+    /* last emitted screen */
+    TUI_Cell      *prev;
+    int            cols, rows;
+    bool           full;             /* next frame repaints everything */
+
+    /* terminal state as we believe it to be */
+    int            cx, cy;
+    bool           cur_known;
+    int            fg, bg;           /* -1 = unknown */
+
+    /* output */
+    char          *out;
+    size_t         len, cap;
+
+    /* input */
+    unsigned char  in[256];
+    size_t         in_len;
+    char           text[8];
+    uint64_t       next_frame_ms;
+
+    TUI_AnsiStats  stats;
+};
+
+static volatile sig_atomic_t winch = 1;
+
+static void on_winch(int sig) { (void)sig; winch = 1; }
+
+/* ── Output buffer ─────────────────────────────────────── */
+
+static void out_put(TUI_Ansi *a, const char *s, size_t n)
+{
+    if (a->len + n > a->cap) {
+        size_t nc = a->cap ? a->cap * 2 : 16384;
+        while (nc < a->len + n) nc *= 2;
+        char *no = realloc(a->out, nc);
+        if (!no) return;
+        a->out = no;
+        a->cap = nc;
+    }
+    memcpy(a->out + a->len, s, n);
+    a->len += n;
+}
+
+static void out_str(TUI_Ansi *a, const char *s) { out_put(a, s, strlen(s)); }
+
+static void out_flush(TUI_Ansi *a)
+{
+    size_t off = 0;
+    a->stats.bytes_last    = a->len;
+    a->stats.syscalls_last = 0;
+    while (off < a->len) {
+        ssize_t w = write(a->fd_out, a->out + off, a->len - off);
+        a->stats.syscalls_last++;
+        if (w < 0) {
+            if (errno == EINTR || errno == EAGAIN) continue;
+            break;
+        }
+        off += (size_t)w;
+    }
+    a->stats.bytes_total    += a->stats.bytes_last;
+    a->stats.syscalls_total += a->stats.syscalls_last;
+    a->len = 0;
+}
+
+/* ── Cell comparison ───────────────────────────────────── */
+
+static char vis_ch(char c)
+{
+    unsigned char v = (unsigned char)c;
+    return (v >= 32 && v <= 126)
+        || (v >= (unsigned char)TUI_BLOCK(1) && v <= (unsigned char)TUI_BLOCK(8))
+         ? c : ' ';
+}
+
+/* blocks go out as U+2581..U+2588 */
+static void out_cell(TUI_Ansi *a, char c)
+{
+    unsigned char v = (unsigned char)c;
+    if (v < 32) {
+        char u[3] = {(char)0xe2, (char)0x96,
+                     (char)(0x81 + v - (unsigned char)TUI_BLOCK(1))};
+        out_put(a, u, 3);
+    } else {
+        out_put(a, &c, 1);
+    }
+}
+
+/* foreground colour of a blank cell is invisible */
+static bool same_look(TUI_Cell a, TUI_Cell b)
+{
+    char ca = vis_ch(a.ch), cb = vis_ch(b.ch);
+    if (ca != cb || a.bg % TUI_PALETTE_SIZE != b.bg % TUI_PALETTE_SIZE)
+        return false;
+    return ca == ' ' || a.fg % TUI_PALETTE_SIZE == b.fg % TUI_PALETTE_SIZE;
+}
+
+/* cell can be re-emitted as-is under the current SGR state */
+static bool fits_sgr(const TUI_Ansi *a, TUI_Cell c)
+{
+    if (c.bg % TUI_PALETTE_SIZE != a->bg) return false;
+    return vis_ch(c.ch) == ' ' || c.fg % TUI_PALETTE_SIZE == a->fg;
+}
+
+/* ── Cursor motion ─────────────────────────────────────── */
+
+static int seq(char *buf, const char *fmt, int n)
+{
+    return snprintf(buf, 16, fmt, n);
+}
+
+static void move_to(TUI_Ansi *a, const TUI_Cell *row, int x, int y)
+{
+    if (a->cur_known && a->cx == x && a->cy == y) return;
+
+    char best[32];
+    int  bl;
+    if (x == 0 && y == 0) bl = snprintf(best, sizeof best, "\x1b[H");
+    else if (x == 0)      bl = snprintf(best, sizeof best, "\x1b[%dH", y + 1);
+    else bl = snprintf(best, sizeof best, "\x1b[%d;%dH", y + 1, x + 1);
+    bool reemit = false;
+
+    if (a->cur_known) {
+        /* vertical: LF runs or CUD / CUU */
+        char v[16] = "";
+        int  vl = 0, dy = y - a->cy;
+        if (dy > 0 && dy <= 4) { memset(v, '\n', (size_t)dy); vl = dy; }
+        else if (dy > 0)       vl = seq(v, "\x1b[%dB", dy);
+        else if (dy < 0)       vl = seq(v, "\x1b[%dA", -dy);
+
+        /* horizontal: nothing, CR, CUF / CUB, CHA or re-emitting cells */
+        char h[16] = "";
+        int  hl = 0, dx = x - a->cx;
+        bool h_reemit = false;
+        if (dx > 0) {
+            hl = seq(h, "\x1b[%dC", dx);
+            if (dx < hl) {
+                h_reemit = true;
+                for (int i = a->cx; i < x; i++)
+                    if (!fits_sgr(a, row[i])) { h_reemit = false; break; }
+                if (h_reemit) hl = dx;
+            }
+        } else if (dx < 0) {
+            if (x == 0) { h[0] = '\r'; hl = 1; }
+            else if (-dx <= 3) { memset(h, '\b', (size_t)-dx); hl = -dx; }
+            else hl = seq(h, "\x1b[%dD", -dx);
+        }
+        if (dx != 0 && !h_reemit) {
+            char g[16];
+            int  gl = seq(g, "\x1b[%dG", x + 1);
+            if (gl < hl) { memcpy(h, g, (size_t)gl); hl = gl; }
+        }
+
+        if (vl + hl < bl) {
+            memcpy(best, v, (size_t)vl);
+            if (!h_reemit) memcpy(best + vl, h, (size_t)hl);
+            bl = vl + (h_reemit ? 0 : hl);
+            reemit = h_reemit;
+        }
+    }
+
+    out_put(a, best, (size_t)bl);
+    if (reemit) {
+        for (int i = a->cx; i < x; i++) {
+            out_cell(a, vis_ch(row[i].ch));
+        }
+    }
+    a->cx = x;
+    a->cy = y;
+    a->cur_known = true;
+}
+
+/* ── SGR ───────────────────────────────────────────────── */
+
+static int sgr_code(int col, bool bg)
+{
+    if (col < 8) return (bg ? 40 : 30) + col;
+    return (bg ? 100 : 90) + col - 8;
+}
+
+static void set_sgr(TUI_Ansi *a, int fg, int bg)
+{
+    char buf[24];
+    int  n = 0;
+    bool dfg = fg >= 0 && fg != a->fg;
+    bool dbg = bg != a->bg;
+    if (!dfg && !dbg) return;
+    if (dfg && dbg)
+        n = snprintf(buf, sizeof buf, "\x1b[%d;%dm",
+                     sgr_code(fg, false), sgr_code(bg, true));
+    else if (dfg)
+        n = snprintf(buf, sizeof buf, "\x1b[%dm", sgr_code(fg, false));
+    else
+        n = snprintf(buf, sizeof buf, "\x1b[%dm", sgr_code(bg, true));
+    out_put(a, buf, (size_t)n);
+    if (dfg) a->fg = fg;
+    a->bg = bg;
+}
+
+/* ── Frame ─────────────────────────────────────────────── */
+
+void tui_ansi_present(TUI *t)
+{
+    TUI_Ansi *a = t->ansi;
+
+    if (a->cols != t->cols || a->rows != t->rows || !a->prev) {
+        free(a->prev);
+        a->prev = calloc((size_t)t->cols * (size_t)t->rows, sizeof(TUI_Cell));
+        if (!a->prev) return;
+        a->cols = t->cols;
+        a->rows = t->rows;
+        a->full = true;
+    }
+    if (a->full) {
+        out_str(a, "\x1b[0m");
+        a->fg = a->bg = -1;
+        a->cur_known = false;
+    }
+
+    uint64_t cells = 0;
+    for (int y = 0; y < t->rows; y++) {
+        const TUI_Cell *row  = t->cells + (size_t)y * t->cols;
+        TUI_Cell       *prow = a->prev  + (size_t)y * t->cols;
+        int x = 0;
+        while (x < t->cols) {
+            if (!a->full && same_look(row[x], prow[x])) { x++; continue; }
+
+            /* run of blanks sharing one background */
+            int bg  = row[x].bg % TUI_PALETTE_SIZE;
+            int run = 0;
+            while (x + run < t->cols && vis_ch(row[x + run].ch) == ' '
+                   && row[x + run].bg % TUI_PALETTE_SIZE == bg)
+                run++;
+
+            if ((x + run == t->cols && run >= 3) || run >= ECH_MIN) {
+                move_to(a, row, x, y);
+                set_sgr(a, -1, bg);
+                if (x + run == t->cols) {
+                    out_str(a, "\x1b[K");
+                } else {
+                    char buf[16];
+                    out_put(a, buf, (size_t)seq(buf, "\x1b[%dX", run));
+                }
+                memcpy(prow + x, row + x, (size_t)run * sizeof(TUI_Cell));
+                cells += (uint64_t)run;
+                x += run;
+                continue;
+            }
+
+            char c = vis_ch(row[x].ch);
+            move_to(a, row, x, y);
+            set_sgr(a, c == ' ' ? -1 : row[x].fg % TUI_PALETTE_SIZE, bg);
+            out_cell(a, c);
+            prow[x] = row[x];
+            cells++;
+            x++;
+            a->cx = x;
+            if (x >= t->cols) a->cur_known = false;   /* pending wrap */
+        }
+    }
+    a->full = false;
+
+    a->stats.frames++;
+    a->stats.cells_last = cells;
+    if (a->len) out_flush(a);
+    else a->stats.bytes_last = a->stats.syscalls_last = 0;
+
+    a->next_frame_ms = SDL_GetTicks() + FRAME_MS;
+}
+
+void tui_ansi_size(TUI *t, int *cols, int *rows)
+{
+    TUI_Ansi *a = t->ansi;
+    if (!winch) return;
+    winch = 0;
+    struct winsize ws;
+    if (ioctl(a->fd_out, TIOCGWINSZ, &ws) == 0 && ws.ws_col && ws.ws_row) {
+        *cols = ws.ws_col;
+        *rows = ws.ws_row;
+    }
+}
+
+/* ── Input ─────────────────────────────────────────────── */
+
+static void key_event(SDL_Event *e, SDL_Keycode key, SDL_Keymod mod)
+{
+    memset(e, 0, sizeof *e);
+    e->type = SDL_EVENT_KEY_DOWN;
+    e->common.timestamp = SDL_GetTicksNS();
+    e->key.key  = key;
+    e->key.mod  = mod;
+    e->key.down = true;
+}
+
+/* decode one event from the front of the input buffer; returns bytes used */
+static size_t decode(TUI_Ansi *a, SDL_Event *e)
+{
+    const unsigned char *b = a->in;
+    size_t n = a->in_len;
+
+    if (b[0] == 0x1b) {
+        if (n == 1) return 0;          /* ESC alone or split sequence */
+        if (b[1] == '[' || b[1] == 'O') {
+            /* parameter bytes, then intermediates, then the final byte;
+               only the first two numbers matter: key and modifiers */
+            size_t i = 2;
+            int    p[2] = {0, 0}, np = 0;
+            for (; i < n && b[i] >= 0x30 && b[i] <= 0x3f; i++) {
+                if (b[i] == ';') np++;
+                else if (b[i] <= '9' && np < 2 && p[np] < 10000)
+                    p[np] = p[np] * 10 + (b[i] - '0');
+            }
+            while (i < n && b[i] >= 0x20 && b[i] <= 0x2f) i++;
+            if (i >= n) return 0;                     /* incomplete */
+            if (b[i] < 0x40 || b[i] > 0x7e) {         /* malformed */
+                e->type = 0;
+                return i;
+            }
+            SDL_Keycode k = 0;
+            SDL_Keymod  m = 0;
+            /* xterm: 1 + shift 1, alt 2, ctrl 4, meta 8 */
+            int mods = p[1] > 1 ? p[1] - 1 : 0;
+            if (mods & 1) m |= SDL_KMOD_SHIFT;
+            if (mods & 2) m |= SDL_KMOD_ALT;
+            if (mods & 4) m |= SDL_KMOD_CTRL;
+            if (mods & 8) m |= SDL_KMOD_GUI;
+            switch (b[i]) {
+            case 'A': k = SDLK_UP;    break;
+            case 'B': k = SDLK_DOWN;  break;
+            case 'C': k = SDLK_RIGHT; break;
+            case 'D': k = SDLK_LEFT;  break;
+            case 'H': k = SDLK_HOME;  break;
+            case 'F': k = SDLK_END;   break;
+            case 'Z': k = SDLK_TAB; m |= SDL_KMOD_SHIFT; break;
+            case '~':
+                switch (p[0]) {
+                case 1: case 7: k = SDLK_HOME;     break;
+                case 4: case 8: k = SDLK_END;      break;
+                case 3:         k = SDLK_DELETE;   break;
+                case 5:         k = SDLK_PAGEUP;   break;
+                case 6:         k = SDLK_PAGEDOWN; break;
+                default: break;
+                }
+                break;
+            default: break;
+            }
+            if (k) key_event(e, k, m);
+            else   e->type = 0;
+            return i + 1;
+        }
+        key_event(e, SDLK_ESCAPE, 0);
+        return 1;
+    }
+
+    switch (b[0]) {
+    case '\r': case '\n': key_event(e, SDLK_RETURN, 0);    return 1;
+    case '\t':            key_event(e, SDLK_TAB, 0);       return 1;
+    case 0x7f: case 0x08: key_event(e, SDLK_BACKSPACE, 0); return 1;
+    default: break;
+    }
+    if (b[0] < 0x20) {
+        key_event(e, (SDL_Keycode)('a' + b[0] - 1), SDL_KMOD_CTRL);
+        return 1;
+    }
+
+    /* printable: one UTF-8 sequence becomes one text event */
+    size_t len = b[0] < 0x80 ? 1 : b[0] >= 0xf0 ? 4 : b[0] >= 0xe0 ? 3 : 2;
+    if (len > n) return 0;
+    memcpy(a->text, b, len);
+    a->text[len] = '\0';
+    memset(e, 0, sizeof *e);
+    e->type = SDL_EVENT_TEXT_INPUT;
+    e->common.timestamp = SDL_GetTicksNS();
+    e->text.text = a->text;
+    return len;
+}
+
+bool tui_ansi_poll(TUI *t, SDL_Event *e)
+{
+    TUI_Ansi *a = t->ansi;
+
+    for (;;) {
+        if (a->in_len) {
+            size_t used = decode(a, e);
+            if (used) {
+                memmove(a->in, a->in + used, a->in_len - used);
+                a->in_len -= used;
+                if (e->type) return true;
+                continue;
+            }
+        }
+
+        /* a full buffer that does not decode would make the read below
+           ask for 0 bytes, which looks like a hangup: drop the stuck
+           sequence, up to where the next one starts */
+        if (a->in_len == sizeof a->in) {
+            unsigned char *next = memchr(a->in + 1, 0x1b, a->in_len - 1);
+            size_t drop = next ? (size_t)(next - a->in) : a->in_len;
+            memmove(a->in, a->in + drop, a->in_len - drop);
+            a->in_len -= drop;
+            continue;
+        }
+
+        /* wait for input until the next frame is due */
+        uint64_t now = SDL_GetTicks();
+        int wait = a->next_frame_ms > now ? (int)(a->next_frame_ms - now) : 0;
+        struct pollfd pfd = {a->fd_in, POLLIN, 0};
+        if (poll(&pfd, 1, wait) <= 0) {
+            if (a->in_len && a->in[0] == 0x1b) {   /* lone ESC */
+                key_event(e, SDLK_ESCAPE, 0);
+                memmove(a->in, a->in + 1, --a->in_len);
+                return true;
+            }
+            a->in_len = 0;                /* drop a truncated sequence */
+            return false;
+        }
+        ssize_t r = read(a->fd_in, a->in + a->in_len,
+                         sizeof a->in - a->in_len);
+        if (r <= 0) {
+            if (r == 0 || (errno != EINTR && errno != EAGAIN)) {   /* EOF */
+                SDL_Event q = {0};
+                q.type = SDL_EVENT_QUIT;
+                *e = q;
+                return true;
+            }
+            return false;
+        }
+        a->in_len += (size_t)r;
+    }
+}
+
+/* ── Lifecycle ─────────────────────────────────────────── */
+
+bool tui_init_ansi(TUI *t, int fd_in, int fd_out)
+{
+    struct winsize ws = {0};
+    if (ioctl(fd_out, TIOCGWINSZ, &ws) != 0 || !ws.ws_col || !ws.ws_row) {
+        ws.ws_col = 80;
+        ws.ws_row = 24;
+    }
+    if (!tui_init_headless(t, ws.ws_col, ws.ws_row)) return false;
+
+    TUI_Ansi *a = calloc(1, sizeof *a);
+    if (!a) return false;
+    a->fd_in  = fd_in;
+    a->fd_out = fd_out;
+    a->fg = a->bg = -1;
+
+    if (tcgetattr(fd_in, &a->saved) == 0) {
+        struct termios raw = a->saved;
+        raw.c_iflag &= ~(tcflag_t)(BRKINT | ICRNL | INPCK | ISTRIP | IXON);
+        raw.c_oflag &= ~(tcflag_t)OPOST;
+        raw.c_cflag |= CS8;
+        raw.c_lflag &= ~(tcflag_t)(ECHO | ICANON | IEXTEN | ISIG);
+        raw.c_cc[VMIN]  = 0;
+        raw.c_cc[VTIME] = 0;
+        a->raw = tcsetattr(fd_in, TCSAFLUSH, &raw) == 0;
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof sa);
+    sa.sa_handler = on_winch;
+    sigaction(SIGWINCH, &sa, NULL);
+    winch = 0;
+
+    t->ansi = a;
+    /* alternate screen, hide cursor, no auto-wrap */
+    out_str(a, "\x1b[?1049h\x1b[?25l\x1b[?7l");
+    out_flush(a);
+    a->stats.bytes_total = a->stats.syscalls_total = 0;
+    return true;
+}
+
+void tui_ansi_close(TUI *t)
+{
+    TUI_Ansi *a = t->ansi;
+    if (!a) return;
+    out_str(a, "\x1b[0m\x1b[?7h\x1b[?25h\x1b[?1049l");
+    out_flush(a);
+    if (a->raw) tcsetattr(a->fd_in, TCSAFLUSH, &a->saved);
+    signal(SIGWINCH, SIG_DFL);
+    free(a->prev);
+    free(a->out);
+    free(a);
+    t->ansi = NULL;
+}
+
+void tui_ansi_stats(const TUI *t, TUI_AnsiStats *out)
+{
+    if (t->ansi) *out = t->ansi->stats;
+    else memset(out, 0, sizeof *out);
+}
+
+#else /* _WIN32 */
+
+bool tui_init_ansi(TUI *t, int fd_in, int fd_out)
+{
+    (void)t; (void)fd_in; (void)fd_out;
+    return SDL_SetError("ANSI backend is only available on Unix ttys");
+}
+
+void tui_ansi_close(TUI *t) { (void)t; }
+void tui_ansi_stats(const TUI *t, TUI_AnsiStats *out)
+{
+    (void)t;
+    memset(out, 0, sizeof *out);
+}
+void tui_ansi_size(TUI *t, int *cols, int *rows) { (void)t; (void)cols; (void)rows; }
+void tui_ansi_present(TUI *t) { (void)t; }
+bool tui_ansi_poll(TUI *t, SDL_Event *e) { (void)t; (void)e; return false; }
+
+#endif
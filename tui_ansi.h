@@ -0,0 +1,33 @@
+#ifndef TUI_ANSI_H
+#define TUI_ANSI_H
+
+#include "tui.h"
+
+/*
+ * ANSI tty backend.
+ *
+ * Renders the cell grid to a Unix terminal instead of an SDL window.
+ * Each tui_end() diffs the grid against what was last emitted and sends
+ * only the changed cells -- cheapest cursor motion, SGR changes only when
+ * the colour actually differs, erase sequences for runs of blanks -- in a
+ * single write().  Keyboard input from the tty is decoded into SDL key and
+ * text events and returned by tui_poll_event().
+ */
+
+typedef struct {
+    uint64_t frames;
+    uint64_t bytes_last,    bytes_total;
+    uint64_t syscalls_last, syscalls_total;   /* write() calls */
+    uint64_t cells_last;                       /* cells emitted  */
+} TUI_AnsiStats;
+
+bool tui_init_ansi (TUI *t, int fd_in, int fd_out);
+void tui_ansi_close(TUI *t);
+void tui_ansi_stats(const TUI *t, TUI_AnsiStats *out);
+
+/* hooks used by tui_begin / tui_end / tui_poll_event */
+void tui_ansi_size   (TUI *t, int *cols, int *rows);
+void tui_ansi_present(TUI *t);
+bool tui_ansi_poll   (TUI *t, SDL_Event *e);
+
+#endif /* TUI_ANSI_H */
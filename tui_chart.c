@@ -0,0 +1,285 @@
+#include "tui_chart.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tui_alloc.h"
+
+#define FAN_BITS   4                  /* 16 entries per summary block */
+#define MAX_LEVELS 8
+
+typedef struct { float min, max; } MinMax;
+
+static const MinMax EMPTY = {INFINITY, -INFINITY};
+
+struct TUI_Series {
+    float         *raw;
+    uint64_t       cap;               /* power of two */
+    int            levels;
+    MinMax        *sum[MAX_LEVELS + 1];   /* sum[k]: blocks of 16^k, k >= 1 */
+    uint64_t       n;                 /* producer's count */
+    SDL_AtomicU32  pub;               /* low 32 bits of n, published */
+    uint64_t       seen;              /* reader's widened copy */
+};
+
+struct TUI_Chart {
+    TUI_Series    *s;
+    TUI_ChartKind  kind;
+    uint64_t       window;
+    float          lo, hi;
+
+    int            cols;
+    uint64_t       spc;               /* samples per column */
+    MinMax        *col;               /* column k lives at col[k % cols] */
+    uint64_t       next;              /* first column not yet final */
+    uint64_t       last;              /* newest column at the last update */
+};
+
+/* ── Series ────────────────────────────────────────────── */
+
+static uint64_t entries(const TUI_Series *s, int k)
+{
+    return s->cap >> (FAN_BITS * k);
+}
+
+TUI_Series *tui_series_new(int capacity)
+{
+    TUI_Series *s = calloc(1, sizeof *s);
+    if (!s) return NULL;
+    s->cap = 64;
+    while (s->cap < (uint64_t)capacity) s->cap <<= 1;
+    s->raw = malloc(s->cap * sizeof *s->raw);
+    if (!s->raw) goto fail;
+    while (s->levels < MAX_LEVELS && entries(s, s->levels + 1) >= 1) {
+        int k = ++s->levels;
+        s->sum[k] = malloc(entries(s, k) * sizeof(MinMax));
+        if (!s->sum[k]) goto fail;
+    }
+    return s;
+
+fail:
+    tui_series_free(s);
+    return NULL;
+}
+
+void tui_series_free(TUI_Series *s)
+{
+    if (!s) return;
+    for (int k = 1; k <= s->levels; k++) free(s->sum[k]);
+    free(s->raw);
+    free(s);
+}
+
+static void put(TUI_Series *s, float v)
+{
+    uint64_t i = s->n++, end = s->n;
+    s->raw[i & (s->cap - 1)] = v;
+
+    /* summarise every block this sample completes, bottom up */
+    for (int k = 1; k <= s->levels; k++) {
+        if (end & ((1ull << (FAN_BITS * k)) - 1)) break;
+        uint64_t blk = (end >> (FAN_BITS * k)) - 1;
+        MinMax m = EMPTY;
+        if (k == 1) {
+            for (uint64_t j = 0; j < (1u << FAN_BITS); j++) {
+                float x = s->raw[((blk << FAN_BITS) + j) & (s->cap - 1)];
+                if (x < m.min) m.min = x;
+                if (x > m.max) m.max = x;
+            }
+        } else {
+            uint64_t mask = entries(s, k - 1) - 1;
+            for (uint64_t j = 0; j < (1u << FAN_BITS); j++) {
+                MinMax e = s->sum[k - 1][((blk << FAN_BITS) + j) & mask];
+                if (e.min < m.min) m.min = e.min;
+                if (e.max > m.max) m.max = e.max;
+            }
+        }
+        s->sum[k][blk & (entries(s, k) - 1)] = m;
+    }
+}
+
+void tui_series_push(TUI_Series *s, float v)
+{
+    put(s, v);
+    SDL_SetAtomicU32(&s->pub, (Uint32)s->n);
+}
+
+void tui_series_push_n(TUI_Series *s, const float *v, int n)
+{
+    for (int i = 0; i < n; i++) put(s, v[i]);
+    SDL_SetAtomicU32(&s->pub, (Uint32)s->n);
+}
+
+uint64_t tui_series_count(TUI_Series *s)
+{
+    Uint32 lo = SDL_GetAtomicU32(&s->pub);
+    s->seen += (Uint32)(lo - (Uint32)s->seen);
+    return s->seen;
+}
+
+bool tui_series_range(TUI_Series *s, uint64_t a, uint64_t b,
+                      float *min, float *max)
+{
+    uint64_t n = tui_series_count(s), hold = s->cap - s->cap / 4;
+    if (n > hold && a < n - hold) a = n - hold;
+    if (b > n) b = n;
+    if (a >= b) return false;
+
+    /* greedy: the largest aligned summary block that fits, else a sample */
+    MinMax m = EMPTY;
+    while (a < b) {
+        int k = 0;
+        while (k < s->levels) {
+            uint64_t size = 1ull << (FAN_BITS * (k + 1));
+            if ((a & (size - 1)) || a + size > b) break;
+            k++;
+        }
+        if (k == 0) {
+            float x = s->raw[a & (s->cap - 1)];
+            if (x < m.min) m.min = x;
+            if (x > m.max) m.max = x;
+            a++;
+        } else {
+            MinMax e = s->sum[k][(a >> (FAN_BITS * k)) & (entries(s, k) - 1)];
+            if (e.min < m.min) m.min = e.min;
+            if (e.max > m.max) m.max = e.max;
+            a += 1ull << (FAN_BITS * k);
+        }
+    }
+    *min = m.min;
+    *max = m.max;
+    return true;
+}
+
+/* ── Chart ─────────────────────────────────────────────── */
+
+TUI_Chart *tui_chart_new(TUI_Series *s, TUI_ChartKind kind, uint64_t window)
+{
+    TUI_Chart *c = calloc(1, sizeof *c);
+    if (!c) return NULL;
+    c->s      = s;
+    c->kind   = kind;
+    c->window = window ? window : 1;
+    return c;
+}
+
+void tui_chart_free(TUI_Chart *c)
+{
+    if (!c) return;
+    free(c->col);
+    free(c);
+}
+
+void tui_chart_set_window(TUI_Chart *c, uint64_t window)
+{
+    c->window = window ? window : 1;
+}
+
+void tui_chart_set_range(TUI_Chart *c, float lo, float hi)
+{
+    c->lo = lo;
+    c->hi = hi;
+}
+
+bool tui_chart_update(TUI_Chart *c, int w)
+{
+    if (w < 1) return false;
+    uint64_t spc = (c->window + (uint64_t)w - 1) / (uint64_t)w;
+    bool changed = false;
+    if (w != c->cols || spc != c->spc || !c->col) {
+        MinMax *col = realloc(c->col, (size_t)w * sizeof *col);
+        if (!col) return false;
+        for (int i = 0; i < w; i++) col[i] = EMPTY;
+        c->col  = col;
+        c->cols = w;
+        c->spc  = spc;
+        c->next = c->last = 0;
+        changed = true;
+    }
+
+    uint64_t n = tui_series_count(c->s);
+    if (n == 0) return changed;
+    uint64_t last  = (n - 1) / spc;
+    uint64_t first = last + 1 >= (uint64_t)w ? last + 1 - (uint64_t)w : 0;
+    if (last != c->last) changed = true;
+
+    /* only columns that started since the last update, and the newest */
+    for (uint64_t k = c->next > first ? c->next : first; k <= last; k++) {
+        uint64_t b = (k + 1) * spc < n ? (k + 1) * spc : n;
+        MinMax m;
+        if (!tui_series_range(c->s, k * spc, b, &m.min, &m.max)) m = EMPTY;
+        MinMax *slot = &c->col[k % (uint64_t)w];
+        if (slot->min != m.min || slot->max != m.max || last != c->last) {
+            *slot   = m;
+            changed = true;
+        }
+    }
+    c->next = n >= (last + 1) * spc ? last + 1 : last;
+    c->last = last;
+    return changed;
+}
+
+static float frac(float v, float lo, float hi)
+{
+    float f = (v - lo) / (hi - lo);
+    return f < 0 ? 0 : f > 1 ? 1 : f;
+}
+
+void tui_draw_chart(TUI *t, int x, int y, int w, int h, TUI_Chart *c,
+                    uint8_t fg, uint8_t bg)
+{
+    if (w < 1 || h < 1) return;
+    tui_fill(t, x, y, w, h, ' ', fg, bg);
+    tui_chart_update(c, w);
+    if (!c->col || tui_series_count(c->s) == 0) return;
+
+    uint64_t last  = c->last;
+    uint64_t first = last + 1 >= (uint64_t)w ? last + 1 - (uint64_t)w : 0;
+
+    float lo = c->lo, hi = c->hi;
+    if (lo == hi) {
+        lo = INFINITY;
+        hi = -INFINITY;
+        for (uint64_t k = first; k <= last; k++) {
+            MinMax m = c->col[k % (uint64_t)w];
+            if (m.min < lo) lo = m.min;
+            if (m.max > hi) hi = m.max;
+        }
+        if (lo > hi) return;
+        if (hi - lo < 1e-6f) { lo -= 1; hi += 1; }
+    }
+
+    /* newest column at the right edge */
+    for (uint64_t k = first; k <= last; k++) {
+        MinMax m = c->col[k % (uint64_t)w];
+        if (m.min > m.max) continue;
+        int cx = x + w - 1 - (int)(last - k);
+
+        switch (c->kind) {
+        case TUI_CHART_SPARK: {
+            int e = 1 + (int)(frac(m.max, lo, hi) * 7 + 0.5f);
+            tui_putc(t, cx, y + h - 1, TUI_BLOCK(e), fg, bg);
+            break;
+        }
+        case TUI_CHART_BARS: {
+            int e = (int)(frac(m.max, lo, hi) * (float)(h * 8) + 0.5f);
+            for (int r = 0; r < h && e > 0; r++, e -= 8)
+                tui_putc(t, cx, y + h - 1 - r,
+                         TUI_BLOCK(e >= 8 ? 8 : e), fg, bg);
+            break;
+        }
+        case TUI_CHART_LINE: {
+            /* three heights per row: '_', '-', '\'' */
+            int top = h * 3 - 1;
+            int a = (int)(frac(m.min, lo, hi) * (float)top + 0.5f);
+            int b = (int)(frac(m.max, lo, hi) * (float)top + 0.5f);
+            if (a == b) {
+                tui_putc(t, cx, y + h - 1 - a / 3, "_-'"[a % 3], fg, bg);
+                break;
+            }
+            for (int r = a / 3; r <= b / 3; r++)
+                tui_putc(t, cx, y + h - 1 - r, '|', fg, bg);
+            break;
+        }
+        }
+    }
+}
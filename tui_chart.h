@@ -0,0 +1,59 @@
+#ifndef TUI_CHART_H
+#define TUI_CHART_H
+
+#include "tui.h"
+
+/*
+ * Time-series charts.
+ *
+ * A TUI_Series is a ring of the last N samples (N a power of two) plus a
+ * min/max summary of every aligned block of 16, 256, 4096 ... samples,
+ * kept up to date as samples arrive.  The min and max of any range are
+ * then read from at most a few dozen summary entries, so a chart decimates
+ * millions of samples to its width in time proportional to the width.
+ *
+ * One producer thread may push while one UI thread reads, without locks:
+ * the producer writes the samples and summaries first and publishes the
+ * new count last.  The reader stays a quarter of the ring behind the
+ * producer, so pushing more than N / 4 samples while a chart is updating
+ * may show torn values for that frame.  The reader must call
+ * tui_series_count() (directly or by drawing) at least once every 2^32
+ * samples.
+ *
+ * A TUI_Chart caches one min/max per column.  Columns are aligned to
+ * absolute sample numbers, so when samples arrive only the newest column,
+ * and any that started since the last update, are recomputed.
+ */
+
+typedef struct TUI_Series TUI_Series;
+typedef struct TUI_Chart  TUI_Chart;
+
+typedef enum {
+    TUI_CHART_SPARK,    /* one row of blocks per column (maximum)      */
+    TUI_CHART_BARS,     /* bars in eighths of a cell (maximum)          */
+    TUI_CHART_LINE,     /* each column spans its minimum to maximum     */
+} TUI_ChartKind;
+
+TUI_Series *tui_series_new (int capacity);  /* rounded up to a power of 2 */
+void        tui_series_free(TUI_Series *s);
+/* producer thread */
+void        tui_series_push  (TUI_Series *s, float v);
+void        tui_series_push_n(TUI_Series *s, const float *v, int n);
+/* reader thread: samples pushed so far */
+uint64_t    tui_series_count (TUI_Series *s);
+/* min / max of samples [a, b); false if none of them is still held */
+bool        tui_series_range (TUI_Series *s, uint64_t a, uint64_t b,
+                              float *min, float *max);
+
+/* window: samples shown across the chart's width */
+TUI_Chart *tui_chart_new  (TUI_Series *s, TUI_ChartKind kind, uint64_t window);
+void       tui_chart_free (TUI_Chart *c);
+void       tui_chart_set_window(TUI_Chart *c, uint64_t window);
+/* fixed vertical range; lo == hi scales to the visible data */
+void       tui_chart_set_range (TUI_Chart *c, float lo, float hi);
+/* bring the columns up to date for width w; true if any visible changed */
+bool       tui_chart_update(TUI_Chart *c, int w);
+void       tui_draw_chart  (TUI *t, int x, int y, int w, int h, TUI_Chart *c,
+                            uint8_t fg, uint8_t bg);
+
+#endif /* TUI_CHART_H */
@@ -0,0 +1,292 @@
+#include "tui_cmd.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tui_alloc.h"
+
+typedef struct {
+    char      *name, *help;
+    TUI_CmdFn  fn;
+    void      *user;
+    int        flags;
+    uint32_t   hash;
+} Cmd;
+
+struct TUI_CmdCtx {
+    TUI_CmdRegistry *r;
+    TUI_Job         *job;           /* NULL when run on the caller */
+};
+
+typedef struct {
+    TUI_CmdFn   fn;
+    void       *user;
+    TUI_CmdCtx  ctx;
+    int         argc;
+    char      **argv;               /* words follow the struct */
+} CmdJob;
+
+typedef struct Line {
+    struct Line *next;
+    uint8_t      fg;
+    char         text[];
+} Line;
+
+struct TUI_CmdRegistry {
+    Cmd          *slots;            /* open addressing, power of two */
+    int           cap, count;
+
+    TUI_JobPool  *pool;
+    TUI_JobToken  tok;              /* every background command */
+
+    SDL_Mutex    *out_lock;
+    Line         *out_head, *out_tail;
+};
+
+/* ── Hash table ────────────────────────────────────────── */
+
+static uint32_t hash_name(const char *s)
+{
+    uint32_t h = 2166136261u;                           /* FNV-1a */
+    for (; *s; s++) h = (h ^ (unsigned char)*s) * 16777619u;
+    return h;
+}
+
+static Cmd *find_slot(const TUI_CmdRegistry *r, const char *name, uint32_t h)
+{
+    for (int i = (int)h & (r->cap - 1);; i = (i + 1) & (r->cap - 1)) {
+        Cmd *c = &r->slots[i];
+        if (!c->name || (c->hash == h && strcmp(c->name, name) == 0))
+            return c;
+    }
+}
+
+static bool grow(TUI_CmdRegistry *r)
+{
+    int cap = r->cap ? r->cap * 2 : 32;
+    Cmd *old = r->slots, *slots = calloc((size_t)cap, sizeof *slots);
+    if (!slots) return false;
+    int old_cap = r->cap;
+    r->slots = slots;
+    r->cap   = cap;
+    for (int i = 0; i < old_cap; i++)
+        if (old[i].name) *find_slot(r, old[i].name, old[i].hash) = old[i];
+    free(old);
+    return true;
+}
+
+/* ── Tokenizer ─────────────────────────────────────────── */
+
+/* buf needs 2 * strlen(s) + 1 bytes, argv strlen(s) / 2 + 2 entries */
+static int split(const char *s, char *buf, char **argv)
+{
+    int argc = 0;
+    for (;;) {
+        while (*s == ' ' || *s == '\t') s++;
+        if (!*s) break;
+        argv[argc++] = buf;
+        char q = 0;
+        for (; *s && (q || (*s != ' ' && *s != '\t')); s++) {
+            if (q && *s == q)                        q = 0;
+            else if (!q && (*s == '"' || *s == '\'')) q = *s;
+            else if (*s == '\\' && q != '\'' && s[1]) *buf++ = *++s;
+            else                                     *buf++ = *s;
+        }
+        *buf++ = '\0';
+    }
+    argv[argc] = NULL;
+    return argc;
+}
+
+/* ── Output ────────────────────────────────────────────── */
+
+void tui_cmd_print(TUI_CmdCtx *c, uint8_t fg, const char *fmt, ...)
+{
+    char small[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(small, sizeof small, fmt, ap);
+    va_end(ap);
+    if (n < 0) return;
+
+    Line *ln = malloc(sizeof *ln + (size_t)n + 1);
+    if (!ln) return;
+    if (n < (int)sizeof small) {
+        memcpy(ln->text, small, (size_t)n + 1);
+    } else {
+        va_start(ap, fmt);
+        vsnprintf(ln->text, (size_t)n + 1, fmt, ap);
+        va_end(ap);
+    }
+    ln->fg   = fg;
+    ln->next = NULL;
+
+    TUI_CmdRegistry *r = c->r;
+    SDL_LockMutex(r->out_lock);
+    if (r->out_tail) r->out_tail->next = ln;
+    else             r->out_head = ln;
+    r->out_tail = ln;
+    SDL_UnlockMutex(r->out_lock);
+}
+
+bool tui_cmd_cancelled(const TUI_CmdCtx *c)
+{
+    return c->job && tui_job_cancelled(c->job);
+}
+
+int tui_cmd_drain(TUI_CmdRegistry *r, TUI_CmdSink sink, void *user)
+{
+    SDL_LockMutex(r->out_lock);
+    Line *ln = r->out_head;
+    r->out_head = r->out_tail = NULL;
+    SDL_UnlockMutex(r->out_lock);
+
+    int n = 0;
+    while (ln) {
+        Line *next = ln->next;
+        sink(user, ln->text, ln->fg);
+        free(ln);
+        ln = next;
+        n++;
+    }
+    return n;
+}
+
+/* ── API ───────────────────────────────────────────────── */
+
+TUI_CmdRegistry *tui_cmd_new(TUI_JobPool *pool)
+{
+    TUI_CmdRegistry *r = calloc(1, sizeof *r);
+    if (!r) return NULL;
+    r->pool     = pool;
+    r->out_lock = SDL_CreateMutex();
+    if (!r->out_lock || !grow(r)) {
+        tui_cmd_free(r);
+        return NULL;
+    }
+    return r;
+}
+
+void tui_cmd_free(TUI_CmdRegistry *r)
+{
+    if (!r) return;
+    if (r->pool) {
+        tui_cmd_cancel(r);
+        tui_job_wait(r->pool, &r->tok);
+    }
+    for (Line *ln = r->out_head, *next; ln; ln = next) {
+        next = ln->next;
+        free(ln);
+    }
+    for (int i = 0; i < r->cap; i++) {
+        SDL_free(r->slots[i].name);
+        SDL_free(r->slots[i].help);
+    }
+    free(r->slots);
+    if (r->out_lock) SDL_DestroyMutex(r->out_lock);
+    free(r);
+}
+
+bool tui_cmd_register(TUI_CmdRegistry *r, const char *name, const char *help,
+                      TUI_CmdFn fn, void *user, int flags)
+{
+    if ((r->count + 1) * 2 > r->cap && !grow(r)) return false;
+    uint32_t h = hash_name(name);
+    Cmd *c = find_slot(r, name, h);
+    char *hs = SDL_strdup(help ? help : "");
+    char *ns = c->name ? c->name : SDL_strdup(name);
+    if (!hs || !ns) {
+        SDL_free(hs);
+        if (ns != c->name) SDL_free(ns);
+        return SDL_SetError("out of memory");
+    }
+    if (!c->name) r->count++;
+    SDL_free(c->help);
+    c->name  = ns;
+    c->help  = hs;
+    c->fn    = fn;
+    c->user  = user;
+    c->flags = flags;
+    c->hash  = h;
+    return true;
+}
+
+const char *tui_cmd_help(const TUI_CmdRegistry *r, const char *name)
+{
+    const Cmd *c = find_slot(r, name, hash_name(name));
+    return c->name ? c->help : NULL;
+}
+
+static void cmd_job_main(TUI_Job *j, void *user)
+{
+    CmdJob *cj = user;
+    cj->ctx.job = j;
+    if (!tui_job_cancelled(j)) cj->fn(&cj->ctx, cj->argc, cj->argv, cj->user);
+    free(cj);
+}
+
+bool tui_cmd_run(TUI_CmdRegistry *r, const char *line)
+{
+    size_t n = strlen(line), nargv = n / 2 + 2;
+    CmdJob *cj = malloc(sizeof *cj + nargv * sizeof(char *) + 2 * n + 1);
+    if (!cj) return SDL_SetError("out of memory");
+    cj->argv = (char **)(cj + 1);
+    cj->argc = split(line, (char *)(cj->argv + nargv), cj->argv);
+    if (cj->argc == 0) {
+        free(cj);
+        return true;
+    }
+
+    const Cmd *c = find_slot(r, cj->argv[0], hash_name(cj->argv[0]));
+    if (!c->name) {
+        SDL_SetError("Unknown command: %s", cj->argv[0]);
+        free(cj);
+        return false;
+    }
+    cj->fn      = c->fn;
+    cj->user    = c->user;
+    cj->ctx.r   = r;
+    cj->ctx.job = NULL;
+
+    if (!(c->flags & TUI_CMD_ASYNC) || !r->pool) {
+        cj->fn(&cj->ctx, cj->argc, cj->argv, cj->user);
+        free(cj);
+        return true;
+    }
+    if (!tui_job_submit(r->pool, cmd_job_main, NULL, cj, &r->tok)) {
+        free(cj);
+        return false;
+    }
+    return true;
+}
+
+int tui_cmd_running(TUI_CmdRegistry *r)
+{
+    return SDL_GetAtomicInt(&r->tok.pending);
+}
+
+void tui_cmd_cancel(TUI_CmdRegistry *r)
+{
+    tui_job_cancel(&r->tok);
+}
+
+static int cmp_name(const void *a, const void *b)
+{
+    return strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+int tui_cmd_complete(const TUI_CmdRegistry *r, const char *prefix,
+                     const char **out, int max)
+{
+    const char **all = malloc((size_t)(r->count ? r->count : 1) * sizeof *all);
+    if (!all) return 0;
+    size_t pn = strlen(prefix);
+    int n = 0;
+    for (int i = 0; i < r->cap; i++)
+        if (r->slots[i].name && strncmp(r->slots[i].name, prefix, pn) == 0)
+            all[n++] = r->slots[i].name;
+    qsort(all, (size_t)n, sizeof *all, cmp_name);
+    for (int i = 0; i < n && i < max; i++) out[i] = all[i];
+    free(all);
+    return n;
+}
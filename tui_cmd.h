@@ -0,0 +1,52 @@
+#ifndef TUI_CMD_H
+#define TUI_CMD_H
+
+#include "tui.h"
+#include "tui_job.h"
+
+/*
+ * Command registry for terminal-style prompts.
+ *
+ * Commands are looked up by name in a hash table.  A command line is split
+ * into words on whitespace; "double" or 'single' quotes keep spaces, and a
+ * backslash escapes the next character.  Commands registered with
+ * TUI_CMD_ASYNC run on a TUI_JobPool so the UI keeps drawing; all
+ * commands print through tui_cmd_print(), and the UI thread collects the
+ * lines with tui_cmd_drain() each frame, so long commands stream output.
+ * tui_cmd_cancel() asks every queued and running command to stop; commands
+ * poll tui_cmd_cancelled() between steps.
+ */
+
+#define TUI_CMD_ASYNC 1            /* flag: run on the job pool */
+
+typedef struct TUI_CmdRegistry TUI_CmdRegistry;
+typedef struct TUI_CmdCtx      TUI_CmdCtx;
+
+typedef void (*TUI_CmdFn)  (TUI_CmdCtx *c, int argc, char **argv, void *user);
+typedef void (*TUI_CmdSink)(void *user, const char *line, uint8_t fg);
+
+/* pool NULL: background commands run on the caller too */
+TUI_CmdRegistry *tui_cmd_new (TUI_JobPool *pool);
+void             tui_cmd_free(TUI_CmdRegistry *r);  /* cancels and waits */
+
+bool        tui_cmd_register(TUI_CmdRegistry *r, const char *name,
+                             const char *help, TUI_CmdFn fn, void *user,
+                             int flags);
+const char *tui_cmd_help    (const TUI_CmdRegistry *r, const char *name);
+
+/* run a line; false (SDL_GetError) for an unknown command */
+bool tui_cmd_run    (TUI_CmdRegistry *r, const char *line);
+int  tui_cmd_running(TUI_CmdRegistry *r);           /* queued + running */
+void tui_cmd_cancel (TUI_CmdRegistry *r);
+/* pass pending output lines to sink in order; returns how many */
+int  tui_cmd_drain  (TUI_CmdRegistry *r, TUI_CmdSink sink, void *user);
+
+/* names starting with prefix, sorted; returns the total count */
+int  tui_cmd_complete(const TUI_CmdRegistry *r, const char *prefix,
+                      const char **out, int max);
+
+/* for use inside commands, from any thread */
+void tui_cmd_print    (TUI_CmdCtx *c, uint8_t fg, const char *fmt, ...);
+bool tui_cmd_cancelled(const TUI_CmdCtx *c);
+
+#endif /* TUI_CMD_H */
@@ -0,0 +1,438 @@
+#include "tui_color.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "tui_alloc.h"
+
+#define DFA_MAX   1024
+#define RULES_MAX 64
+
+/* ── Pattern parser (Thompson NFA) ─────────────────────── */
+
+enum { N_EPS, N_SPLIT, N_SET, N_MATCH };
+
+typedef struct {
+    uint8_t kind;
+    int     out, out1;
+    int     arg;                  /* N_SET: set index, N_MATCH: rule */
+} NState;
+
+typedef struct { uint8_t bits[32]; } ByteSet;
+
+typedef struct {
+    NState  *st;
+    int      nst, cap;
+    ByteSet *sets;
+    int      nsets, sets_cap;
+    const char *p;
+    bool     icase, ok;
+} Nfa;
+
+typedef struct { int start, end; } Frag;
+
+static int nfa_state(Nfa *n, int kind, int out, int out1, int arg)
+{
+    if (n->nst == n->cap) {
+        int nc = n->cap ? n->cap * 2 : 64;
+        NState *ns = realloc(n->st, (size_t)nc * sizeof *ns);
+        if (!ns) { n->ok = false; return 0; }
+        n->st  = ns;
+        n->cap = nc;
+    }
+    n->st[n->nst] = (NState){(uint8_t)kind, out, out1, arg};
+    return n->nst++;
+}
+
+static void set_add(ByteSet *s, int c)
+{
+    s->bits[c >> 3] |= (uint8_t)(1u << (c & 7));
+}
+
+static bool set_has(const ByteSet *s, int c)
+{
+    return s->bits[c >> 3] & (1u << (c & 7));
+}
+
+static void set_add_case(Nfa *n, ByteSet *s, int c)
+{
+    set_add(s, c);
+    if (n->icase && isalpha(c)) {
+        set_add(s, tolower(c) & 0xff);
+        set_add(s, toupper(c) & 0xff);
+    }
+}
+
+static Frag frag_set(Nfa *n, const ByteSet *s)
+{
+    if (n->nsets == n->sets_cap) {
+        int nc = n->sets_cap ? n->sets_cap * 2 : 32;
+        ByteSet *ns = realloc(n->sets, (size_t)nc * sizeof *ns);
+        if (!ns) { n->ok = false; return (Frag){0, 0}; }
+        n->sets     = ns;
+        n->sets_cap = nc;
+    }
+    n->sets[n->nsets] = *s;
+    int end = nfa_state(n, N_EPS, -1, -1, 0);
+    int st  = nfa_state(n, N_SET, end, -1, n->nsets++);
+    return (Frag){st, end};
+}
+
+/* \d \w \s and escaped literals */
+static void escape_set(Nfa *n, ByteSet *s, int c)
+{
+    switch (c) {
+    case 'd': for (int i = '0'; i <= '9'; i++) set_add(s, i); break;
+    case 's': set_add(s, ' '); set_add(s, '\t'); break;
+    case 'w':
+        for (int i = 0; i < 256; i++)
+            if (isalnum(i) || i == '_') set_add(s, i);
+        break;
+    case 't': set_add(s, '\t'); break;
+    default:  set_add_case(n, s, c); break;
+    }
+}
+
+static Frag parse_alt(Nfa *n);
+
+static Frag parse_atom(Nfa *n)
+{
+    ByteSet s;
+    memset(&s, 0, sizeof s);
+    int c = (unsigned char)*n->p++;
+    if (c == '(') {
+        Frag f = parse_alt(n);
+        if (*n->p != ')') { n->ok = false; return f; }
+        n->p++;
+        return f;
+    }
+    if (c == '.') {
+        memset(&s, 0xff, sizeof s);
+    } else if (c == '\\' && *n->p) {
+        escape_set(n, &s, (unsigned char)*n->p++);
+    } else if (c == '[') {
+        bool neg = *n->p == '^';
+        if (neg) n->p++;
+        int prev = -1;
+        while (*n->p && (*n->p != ']' || prev < 0)) {
+            int a = (unsigned char)*n->p++;
+            if (a == '\\' && *n->p) {
+                escape_set(n, &s, (unsigned char)*n->p++);
+                prev = 0;
+            } else if (a == '-' && prev > 0 && *n->p && *n->p != ']') {
+                int b = (unsigned char)*n->p++;
+                for (int i = prev; i <= b; i++) set_add_case(n, &s, i);
+                prev = 0;
+            } else {
+                set_add_case(n, &s, a);
+                prev = a;
+            }
+        }
+        if (*n->p != ']') { n->ok = false; return (Frag){0, 0}; }
+        n->p++;
+        if (neg) for (int i = 0; i < 32; i++) s.bits[i] ^= 0xff;
+    } else {
+        set_add_case(n, &s, c);
+    }
+    return frag_set(n, &s);
+}
+
+static Frag parse_repeat(Nfa *n)
+{
+    Frag f = parse_atom(n);
+    while (n->ok && (*n->p == '*' || *n->p == '+' || *n->p == '?')) {
+        char op = *n->p++;
+        int end = nfa_state(n, N_EPS, -1, -1, 0);
+        int sp  = nfa_state(n, N_SPLIT, f.start, end, 0);
+        if (!n->ok) break;
+        n->st[f.end].out = op == '?' ? end : sp;
+        f = (Frag){op == '+' ? f.start : sp, end};
+    }
+    return f;
+}
+
+static Frag parse_concat(Nfa *n)
+{
+    int e = nfa_state(n, N_EPS, -1, -1, 0);
+    Frag f = {e, e};
+    while (n->ok && *n->p && *n->p != '|' && *n->p != ')') {
+        Frag g = parse_repeat(n);
+        if (!n->ok) break;
+        n->st[f.end].out = g.start;
+        f.end = g.end;
+    }
+    return f;
+}
+
+static Frag parse_alt(Nfa *n)
+{
+    Frag f = parse_concat(n);
+    while (n->ok && *n->p == '|') {
+        n->p++;
+        Frag g   = parse_concat(n);
+        int end  = nfa_state(n, N_EPS, -1, -1, 0);
+        int sp   = nfa_state(n, N_SPLIT, f.start, g.start, 0);
+        if (!n->ok) break;
+        n->st[f.end].out = end;
+        n->st[g.end].out = end;
+        f = (Frag){sp, end};
+    }
+    return f;
+}
+
+/* ── Rules / DFA ───────────────────────────────────────── */
+
+typedef struct {
+    char   *pattern;
+    uint8_t fg;
+    int     flags;
+} Rule;
+
+struct TUI_ColorRules {
+    Rule      rules[RULES_MAX];
+    int       nrules;
+
+    uint16_t (*next)[256];        /* 0 is the dead state */
+    uint8_t  *accept;             /* rule + 1, or 0 */
+    int       nstates, start;
+    ByteSet   first;              /* bytes that can begin a match */
+    uint32_t  gen;
+};
+
+TUI_ColorRules *tui_color_rules_new(void)
+{
+    return calloc(1, sizeof(TUI_ColorRules));
+}
+
+void tui_color_rules_free(TUI_ColorRules *r)
+{
+    if (!r) return;
+    for (int i = 0; i < r->nrules; i++) free(r->rules[i].pattern);
+    free(r->next);
+    free(r->accept);
+    free(r);
+}
+
+bool tui_color_rule(TUI_ColorRules *r, const char *pattern, uint8_t fg,
+                    int flags)
+{
+    if (r->nrules == RULES_MAX) return SDL_SetError("too many colour rules");
+    size_t n = strlen(pattern);
+    char *p = malloc(n + 1);
+    if (!p) return false;
+    memcpy(p, pattern, n + 1);
+    r->rules[r->nrules++] = (Rule){p, fg, flags};
+    return true;
+}
+
+/* epsilon closure of the NFA states in set, as a bitmap */
+static void closure(const Nfa *n, uint32_t *set, int *stack)
+{
+    int sp = 0;
+    for (int i = 0; i < n->nst; i++)
+        if (set[i >> 5] & (1u << (i & 31))) stack[sp++] = i;
+    while (sp) {
+        const NState *s = &n->st[stack[--sp]];
+        int outs[2] = {s->kind == N_EPS || s->kind == N_SPLIT ? s->out : -1,
+                       s->kind == N_SPLIT ? s->out1 : -1};
+        for (int k = 0; k < 2; k++) {
+            int o = outs[k];
+            if (o < 0 || (set[o >> 5] & (1u << (o & 31)))) continue;
+            set[o >> 5] |= 1u << (o & 31);
+            stack[sp++] = o;
+        }
+    }
+}
+
+bool tui_color_compile(TUI_ColorRules *r)
+{
+    Nfa n = {0};
+    n.ok = true;
+    int root = -1;
+    for (int i = 0; i < r->nrules && n.ok; i++) {
+        n.p     = r->rules[i].pattern;
+        n.icase = r->rules[i].flags & TUI_COLOR_ICASE;
+        Frag f  = parse_alt(&n);
+        if (n.ok && *n.p) n.ok = false;          /* stray ')' */
+        if (!n.ok) {
+            free(n.st);
+            free(n.sets);
+            return SDL_SetError("bad colour pattern: %s",
+                                r->rules[i].pattern);
+        }
+        n.st[f.end].out = nfa_state(&n, N_MATCH, -1, -1, i);
+        root = root < 0 ? f.start : nfa_state(&n, N_SPLIT, root, f.start, 0);
+    }
+
+    int words = (n.nst + 31) / 32;
+    size_t wbytes = (size_t)(words ? words : 1) * sizeof(uint32_t);
+    uint32_t *sets  = calloc(DFA_MAX, wbytes);
+    int      *stack = malloc((size_t)(n.nst + 1) * sizeof *stack);
+    uint16_t (*next)[256] = calloc(DFA_MAX, sizeof *next);
+    uint8_t  *accept = calloc(DFA_MAX, 1);
+    bool ok = n.ok && sets && stack && next && accept;
+
+    /* state 0 is dead (empty set); state 1 is the start */
+    int ns = 1;
+    if (ok && root >= 0) {
+        uint32_t *s1 = (uint32_t *)((char *)sets + wbytes);
+        s1[root >> 5] |= 1u << (root & 31);
+        closure(&n, s1, stack);
+        ns = 2;
+    }
+    /* bytes no set tells apart share one column while building */
+    int cls[256] = {0}, rep[256] = {0}, ncls = 1;
+    for (int k = 0; k < n.nsets; k++) {
+        int map[512];
+        memset(map, -1, sizeof map);
+        int nn = 0;
+        for (int c = 0; c < 256; c++) {
+            int key = cls[c] * 2 + set_has(&n.sets[k], c);
+            if (map[key] < 0) map[key] = nn++;
+            cls[c] = map[key];
+        }
+        ncls = nn;
+    }
+    for (int c = 255; c >= 0; c--) rep[cls[c]] = c;
+
+    uint32_t *tmp = calloc(1, wbytes);
+    ok = ok && tmp;
+    for (int d = 1; ok && d < ns; d++) {
+        uint32_t *cur = (uint32_t *)((char *)sets + (size_t)d * wbytes);
+        int best = -1;
+        for (int i = 0; i < n.nst; i++)
+            if ((cur[i >> 5] & (1u << (i & 31))) && n.st[i].kind == N_MATCH
+                && (best < 0 || n.st[i].arg < best))
+                best = n.st[i].arg;
+        accept[d] = (uint8_t)(best + 1);
+
+        for (int k = 0; k < ncls && ok; k++) {
+            int c = rep[k];
+            memset(tmp, 0, wbytes);
+            bool any = false;
+            for (int i = 0; i < n.nst; i++) {
+                if (!(cur[i >> 5] & (1u << (i & 31)))) continue;
+                const NState *s = &n.st[i];
+                if (s->kind == N_SET && set_has(&n.sets[s->arg], c)) {
+                    tmp[s->out >> 5] |= 1u << (s->out & 31);
+                    any = true;
+                }
+            }
+            if (!any) continue;
+            closure(&n, tmp, stack);
+            int t = 1;
+            while (t < ns && memcmp((char *)sets + (size_t)t * wbytes, tmp,
+                                    wbytes) != 0)
+                t++;
+            if (t == ns) {
+                if (ns == DFA_MAX) {
+                    ok = false;
+                    SDL_SetError("colour rules too complex");
+                    break;
+                }
+                memcpy((char *)sets + (size_t)ns++ * wbytes, tmp, wbytes);
+            }
+            for (int b = 0; b < 256; b++)
+                if (cls[b] == k) next[d][b] = (uint16_t)t;
+        }
+    }
+    free(tmp);
+    free(stack);
+    free(sets);
+    free(n.st);
+    free(n.sets);
+    if (!ok) {
+        free(next);
+        free(accept);
+        return false;
+    }
+
+    free(r->next);
+    free(r->accept);
+    r->next    = next;
+    r->accept  = accept;
+    r->nstates = ns;
+    r->start   = ns > 1 ? 1 : 0;
+    memset(&r->first, 0, sizeof r->first);
+    for (int c = 0; c < 256; c++)
+        if (r->start && next[r->start][c]) set_add(&r->first, c);
+    r->gen++;
+    return true;
+}
+
+void tui_color_line(const TUI_ColorRules *r, const char *s, int n,
+                    uint8_t base, uint8_t *out)
+{
+    memset(out, base, (size_t)(n > 0 ? n : 0));
+    if (!r || !r->start) return;
+    const unsigned char *u = (const unsigned char *)s;
+    int i = 0;
+    while (i < n) {
+        if (!set_has(&r->first, u[i])) { i++; continue; }
+        int st = r->start, end = -1, rule = 0;
+        for (int j = i; j < n; j++) {
+            st = r->next[st][u[j]];
+            if (!st) break;
+            if (r->accept[st]) end = j + 1, rule = r->accept[st] - 1;
+        }
+        if (end < 0) { i++; continue; }
+        memset(out + i, r->rules[rule].fg, (size_t)(end - i));
+        i = end;
+    }
+}
+
+/* ── Line cache ────────────────────────────────────────── */
+
+typedef struct {
+    uint64_t key;
+    uint32_t gen;
+    int      len;
+    uint8_t  base;
+    bool     used;
+    uint8_t  fg[TUI_COLOR_LINE_MAX];
+} CacheEntry;
+
+struct TUI_ColorCache {
+    CacheEntry *e;
+    int         n;                /* power of two */
+};
+
+TUI_ColorCache *tui_color_cache_new(int entries)
+{
+    TUI_ColorCache *c = calloc(1, sizeof *c);
+    if (!c) return NULL;
+    c->n = 16;
+    while (c->n < entries) c->n *= 2;
+    c->e = calloc((size_t)c->n, sizeof *c->e);
+    if (!c->e) {
+        free(c);
+        return NULL;
+    }
+    return c;
+}
+
+void tui_color_cache_free(TUI_ColorCache *c)
+{
+    if (!c) return;
+    free(c->e);
+    free(c);
+}
+
+const uint8_t *tui_color_cached(TUI_ColorCache *c, const TUI_ColorRules *r,
+                                uint64_t key, const char *s, int n,
+                                uint8_t base)
+{
+    if (n > TUI_COLOR_LINE_MAX) n = TUI_COLOR_LINE_MAX;
+    uint64_t h = key * 0x9e3779b97f4a7c15ull;
+    CacheEntry *e = &c->e[(h >> 32) & (uint64_t)(c->n - 1)];
+    uint32_t gen = r ? r->gen : 0;
+    if (!e->used || e->key != key || e->len != n || e->base != base
+        || e->gen != gen) {
+        tui_color_line(r, s, n, base, e->fg);
+        e->key  = key;
+        e->len  = n;
+        e->base = base;
+        e->gen  = gen;
+        e->used = true;
+    }
+    return e->fg;
+}
@@ -0,0 +1,43 @@
+#ifndef TUI_COLOR_H
+#define TUI_COLOR_H
+
+#include "tui.h"
+
+/*
+ * Colourisation rules.
+ *
+ * Each rule is a pattern and a foreground colour.  Patterns use a small
+ * regex subset: literals, '.', [a-z0-9] and [^...] classes, \d \w \s,
+ * ( ), |, *, + and ?.  tui_color_compile() turns all rules into one DFA,
+ * so colouring a line is a single scan no matter how many rules there are:
+ * at each position the longest match wins, and the earlier rule wins ties.
+ *
+ * Widgets colour lines only when they draw them, through a TUI_ColorCache
+ * keyed by a line id of their choosing, so appending text costs nothing.
+ */
+
+#define TUI_COLOR_ICASE   1        /* rule flag: match letters in any case */
+#define TUI_COLOR_LINE_MAX 1024    /* bytes coloured per line */
+
+typedef struct TUI_ColorRules TUI_ColorRules;
+typedef struct TUI_ColorCache TUI_ColorCache;
+
+TUI_ColorRules *tui_color_rules_new (void);
+void            tui_color_rules_free(TUI_ColorRules *r);
+bool            tui_color_rule      (TUI_ColorRules *r, const char *pattern,
+                                     uint8_t fg, int flags);
+bool            tui_color_compile   (TUI_ColorRules *r);
+
+/* one colour per byte of s[0, n); bytes no rule matches get base */
+void tui_color_line(const TUI_ColorRules *r, const char *s, int n,
+                    uint8_t base, uint8_t *out);
+
+/* direct-mapped cache of tui_color_line results; an entry is reused when
+   its key, length and base match and the rules have not been recompiled */
+TUI_ColorCache *tui_color_cache_new (int entries);
+void            tui_color_cache_free(TUI_ColorCache *c);
+const uint8_t  *tui_color_cached    (TUI_ColorCache *c,
+                                     const TUI_ColorRules *r, uint64_t key,
+                                     const char *s, int n, uint8_t base);
+
+#endif /* TUI_COLOR_H */
@@ -0,0 +1,782 @@
+#define _POSIX_C_SOURCE 200809L
+#include "tui_edit.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "tui_alloc.h"
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define ED_BLOCK      (64 * 1024)        /* newline index granularity   */
+#define ED_INDEX_STEP 128                /* blocks indexed per frame    */
+#define ED_TAB        4
+#define NL_UNKNOWN    ((size_t)-1)
+#define BLK_UNKNOWN   UINT32_MAX
+
+enum { SRC_ORIG, SRC_ADD };
+
+typedef struct {
+    uint8_t src;
+    size_t  off, len;
+    size_t  nl;                 /* newlines in the piece, lazily counted */
+} Piece;
+
+/* replace [pos, pos + del_len) by ins; undo swaps the two piece lists */
+typedef struct {
+    size_t pos;
+    Piece *del, *ins;
+    int    ndel, nins;
+    size_t del_len, ins_len;
+} EditOp;
+
+struct TUI_Editor {
+    const char *orig;
+    size_t      orig_len;
+    void       *map;            /* munmap / free on close */
+
+    char       *add;
+    size_t      add_len, add_cap;
+
+    Piece      *pc;
+    int         npc, pc_cap;
+    size_t      len;
+
+    uint32_t   *blk;            /* newlines per ED_BLOCK of orig */
+    size_t      nblk, blk_done; /* blocks below blk_done are all counted */
+
+    EditOp     *ops;
+    int         nops, ops_cap, ndone, saved;
+    bool        seal;           /* next edit starts a new undo step */
+
+    int         c_idx;          /* piece lookup cache */
+    size_t      c_start;
+
+    size_t      cursor, top, top_line;
+    int         left, want_col, view_h;
+};
+
+/* ── Storage ───────────────────────────────────────────── */
+
+static bool grow(void **buf, int *cap, int need, size_t elem)
+{
+    if (need <= *cap) return true;
+    int nc = *cap ? *cap : 16;
+    while (nc < need) nc *= 2;
+    void *nb = realloc(*buf, (size_t)nc * elem);
+    if (!nb) return false;
+    *buf = nb;
+    *cap = nc;
+    return true;
+}
+
+static size_t mem_count(const char *p, size_t n)
+{
+    size_t c = 0;
+    const char *end = p + n;
+    while (p < end && (p = memchr(p, '\n', (size_t)(end - p)))) {
+        c++;
+        p++;
+    }
+    return c;
+}
+
+/* a block is counted the first time a count spans it, wherever it is */
+static uint32_t blk_count(TUI_Editor *e, size_t b)
+{
+    if (e->blk[b] == BLK_UNKNOWN) {
+        size_t off = b * ED_BLOCK;
+        size_t n   = e->orig_len - off < ED_BLOCK ? e->orig_len - off
+                                                  : ED_BLOCK;
+        e->blk[b] = (uint32_t)mem_count(e->orig + off, n);
+    }
+    return e->blk[b];
+}
+
+/* count up to n more blocks in file order, skipping those already done */
+static void index_some(TUI_Editor *e, size_t n)
+{
+    for (; e->blk_done < e->nblk; e->blk_done++) {
+        if (e->blk[e->blk_done] != BLK_UNKNOWN) continue;
+        if (n-- == 0) break;
+        blk_count(e, e->blk_done);
+    }
+}
+
+static size_t src_count(TUI_Editor *e, int src, size_t off, size_t len)
+{
+    if (src == SRC_ADD) return mem_count(e->add + off, len);
+
+    size_t end = off + len;
+    size_t b0  = (off + ED_BLOCK - 1) / ED_BLOCK, b1 = end / ED_BLOCK;
+    if (b0 >= b1) return mem_count(e->orig + off, len);
+    size_t n = mem_count(e->orig + off, b0 * ED_BLOCK - off);
+    for (size_t b = b0; b < b1; b++) n += blk_count(e, b);
+    return n + mem_count(e->orig + b1 * ED_BLOCK, end - b1 * ED_BLOCK);
+}
+
+static const char *piece_ptr(const TUI_Editor *e, const Piece *p)
+{
+    return (p->src == SRC_ADD ? e->add : e->orig) + p->off;
+}
+
+static size_t piece_nl(TUI_Editor *e, Piece *p)
+{
+    if (p->nl == NL_UNKNOWN) p->nl = src_count(e, p->src, p->off, p->len);
+    return p->nl;
+}
+
+/* index of the piece holding pos (npc at the end); *start = its offset */
+static int find(TUI_Editor *e, size_t pos, size_t *start)
+{
+    int    i = e->c_idx;
+    size_t s = e->c_start;
+    if (i > e->npc) i = 0, s = 0;
+    while (i > 0 && pos < s) s -= e->pc[--i].len;
+    while (i < e->npc && pos >= s + e->pc[i].len) s += e->pc[i++].len;
+    e->c_idx   = i;
+    e->c_start = s;
+    *start = s;
+    return i;
+}
+
+/* make pos a piece boundary; returns the index of the piece starting there */
+static int split(TUI_Editor *e, size_t pos)
+{
+    size_t s;
+    int i = find(e, pos, &s);
+    if (i == e->npc || pos == s) return i;
+    if (!grow((void **)&e->pc, &e->pc_cap, e->npc + 1, sizeof(Piece)))
+        return -1;
+    memmove(e->pc + i + 1, e->pc + i, (size_t)(e->npc - i) * sizeof(Piece));
+    e->npc++;
+    size_t head = pos - s;
+    e->pc[i].len      = head;
+    e->pc[i].nl       = NL_UNKNOWN;
+    e->pc[i + 1].off += head;
+    e->pc[i + 1].len -= head;
+    e->pc[i + 1].nl   = NL_UNKNOWN;
+    return i + 1;
+}
+
+static size_t line_start(TUI_Editor *e, size_t pos);
+static size_t count_nl  (TUI_Editor *e, size_t from, size_t to);
+
+static size_t ins_nl(TUI_Editor *e, const Piece *ins, int nins)
+{
+    size_t n = 0;
+    for (int k = 0; k < nins; k++)
+        n += ins[k].nl != NL_UNKNOWN
+           ? ins[k].nl : src_count(e, ins[k].src, ins[k].off, ins[k].len);
+    return n;
+}
+
+/* replace [pos, pos + del_len) by ins; removed pieces go to *out if set */
+static bool splice(TUI_Editor *e, size_t pos, size_t del_len,
+                   const Piece *ins, int nins, Piece **out, int *nout)
+{
+    /* newlines removed above the view, counted while they are still there */
+    size_t gone = 0;
+    if (pos < e->top)
+        gone = count_nl(e, pos, pos + del_len < e->top ? pos + del_len
+                                                       : e->top);
+    int i = split(e, pos);
+    int j = split(e, pos + del_len);
+    if (i < 0 || j < 0) return false;
+    i = split(e, pos);                          /* j may have shifted it */
+    int ndel = j - i;
+    if (out) {
+        *out  = NULL;
+        *nout = ndel;
+        if (ndel) {
+            *out = malloc((size_t)ndel * sizeof(Piece));
+            if (!*out) return false;
+            memcpy(*out, e->pc + i, (size_t)ndel * sizeof(Piece));
+        }
+    }
+    if (!grow((void **)&e->pc, &e->pc_cap, e->npc - ndel + nins,
+              sizeof(Piece))) {
+        if (out) free(*out);
+        return false;
+    }
+    memmove(e->pc + i + nins, e->pc + j,
+            (size_t)(e->npc - j) * sizeof(Piece));
+    if (nins) memcpy(e->pc + i, ins, (size_t)nins * sizeof(Piece));
+    e->npc += nins - ndel;
+
+    size_t ins_len = 0;
+    for (int k = 0; k < nins; k++) ins_len += ins[k].len;
+    e->len += ins_len - del_len;
+
+    /* fold a typed piece into the add piece it continues */
+    if (nins == 1 && i > 0 && ins[0].src == SRC_ADD
+        && e->pc[i - 1].src == SRC_ADD
+        && e->pc[i - 1].off + e->pc[i - 1].len == ins[0].off) {
+        Piece *p = &e->pc[i - 1];
+        if (p->nl != NL_UNKNOWN && ins[0].nl != NL_UNKNOWN)
+            p->nl += ins[0].nl;
+        else
+            p->nl = NL_UNKNOWN;
+        p->len += ins[0].len;
+        memmove(e->pc + i, e->pc + i + 1,
+                (size_t)(e->npc - i - 1) * sizeof(Piece));
+        e->npc--;
+    }
+    e->c_idx   = 0;
+    e->c_start = 0;
+
+    /* an edit above the view shifts the first visible line; its number
+       follows from the edit alone, whatever the distance to the start */
+    if (pos < e->top) {
+        if (pos + del_len <= e->top) {
+            e->top      = e->top + ins_len - del_len;
+            e->top_line = e->top_line - gone + ins_nl(e, ins, nins);
+        } else {
+            e->top      = pos;
+            e->top_line = e->top_line - gone;
+        }
+        e->top = line_start(e, e->top);
+    }
+    return true;
+}
+
+/* ── Byte access ───────────────────────────────────────── */
+
+typedef struct {
+    TUI_Editor *e;
+    int         idx;
+    const char *p, *end;
+} Iter;
+
+static void iter_init(Iter *it, TUI_Editor *e, size_t pos)
+{
+    size_t s;
+    it->e   = e;
+    it->idx = find(e, pos, &s);
+    it->p   = it->end = NULL;
+    if (it->idx < e->npc) {
+        const char *base = piece_ptr(e, &e->pc[it->idx]);
+        it->p   = base + (pos - s);
+        it->end = base + e->pc[it->idx].len;
+    }
+}
+
+static int iter_next(Iter *it)
+{
+    while (it->p == it->end) {
+        if (it->idx + 1 >= it->e->npc) return -1;
+        Piece *pc = &it->e->pc[++it->idx];
+        it->p   = piece_ptr(it->e, pc);
+        it->end = it->p + pc->len;
+    }
+    return (unsigned char)*it->p++;
+}
+
+static int byte_at(TUI_Editor *e, size_t pos)
+{
+    size_t s;
+    int i = find(e, pos, &s);
+    if (i == e->npc) return -1;
+    return (unsigned char)piece_ptr(e, &e->pc[i])[pos - s];
+}
+
+#define IS_CONT(c) (((c) & 0xc0) == 0x80)
+
+static size_t cp_prev(TUI_Editor *e, size_t pos)
+{
+    if (pos == 0) return 0;
+    do pos--; while (pos > 0 && IS_CONT(byte_at(e, pos)));
+    return pos;
+}
+
+static size_t cp_next(TUI_Editor *e, size_t pos)
+{
+    if (pos >= e->len) return e->len;
+    do pos++; while (pos < e->len && IS_CONT(byte_at(e, pos)));
+    return pos;
+}
+
+/* offset just past the next newline at or after pos, or the end */
+static size_t next_line(TUI_Editor *e, size_t pos)
+{
+    size_t s;
+    int i = find(e, pos, &s);
+    size_t off = pos - s;
+    for (; i < e->npc; s += e->pc[i++].len, off = 0) {
+        const char *base = piece_ptr(e, &e->pc[i]);
+        const char *nl = memchr(base + off, '\n', e->pc[i].len - off);
+        if (nl) return s + (size_t)(nl - base) + 1;
+    }
+    return e->len;
+}
+
+/* start of the line containing pos */
+static size_t line_start(TUI_Editor *e, size_t pos)
+{
+    size_t s;
+    int i = find(e, pos, &s);
+    size_t off = pos - s;
+    for (;;) {
+        if (i < e->npc) {
+            const char *base = piece_ptr(e, &e->pc[i]);
+            while (off > 0)
+                if (base[--off] == '\n') return s + off + 1;
+        }
+        if (i == 0) return 0;
+        i--;
+        s  -= e->pc[i].len;
+        off = e->pc[i].len;
+    }
+}
+
+static size_t count_nl(TUI_Editor *e, size_t from, size_t to)
+{
+    size_t s, n = 0;
+    int i = find(e, from, &s);
+    for (; i < e->npc && s < to; s += e->pc[i++].len) {
+        Piece *p = &e->pc[i];
+        size_t a = from > s ? from - s : 0;
+        size_t b = to < s + p->len ? to - s : p->len;
+        if (a == 0 && b == p->len) n += piece_nl(e, p);
+        else n += src_count(e, p->src, p->off + a, b - a);
+    }
+    return n;
+}
+
+/* line of pos, counted from the nearer known line: the top of the view
+   or the start of the text */
+static size_t line_at(TUI_Editor *e, size_t pos)
+{
+    if (pos >= e->top) return e->top_line + count_nl(e, e->top, pos);
+    if (e->top - pos < pos) return e->top_line - count_nl(e, pos, e->top);
+    return count_nl(e, 0, pos);
+}
+
+/* display column of pos within the line starting at ls */
+static int pos_col(TUI_Editor *e, size_t ls, size_t pos)
+{
+    Iter it;
+    iter_init(&it, e, ls);
+    int col = 0;
+    for (size_t i = ls; i < pos; i++) {
+        int c = iter_next(&it);
+        if (c == '\t') col = (col / ED_TAB + 1) * ED_TAB;
+        else if (!IS_CONT(c)) col++;
+    }
+    return col;
+}
+
+/* position on the line starting at ls closest to col, not past it */
+static size_t col_pos(TUI_Editor *e, size_t ls, int col)
+{
+    Iter it;
+    iter_init(&it, e, ls);
+    size_t pos = ls;
+    int c, cur = 0;
+    while ((c = iter_next(&it)) >= 0 && c != '\n') {
+        if (!IS_CONT(c)) {
+            int nc = c == '\t' ? (cur / ED_TAB + 1) * ED_TAB : cur + 1;
+            if (nc > col) break;
+            cur = nc;
+        }
+        pos++;
+    }
+    while (pos < e->len && IS_CONT(byte_at(e, pos))) pos++;
+    return pos;
+}
+
+/* ── Open / save ───────────────────────────────────────── */
+
+#ifndef _WIN32
+
+static bool map_file(TUI_Editor *e, const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        if (errno == ENOENT) return true;
+        return SDL_SetError("open %s: %s", path, strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return SDL_SetError("stat %s: %s", path, strerror(errno));
+    }
+    if (st.st_size > 0) {
+        void *m = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE,
+                       fd, 0);
+        if (m == MAP_FAILED) {
+            close(fd);
+            return SDL_SetError("mmap %s: %s", path, strerror(errno));
+        }
+        e->map      = m;
+        e->orig     = m;
+        e->orig_len = (size_t)st.st_size;
+    }
+    close(fd);
+    return true;
+}
+
+static void unmap_file(TUI_Editor *e)
+{
+    if (e->map) munmap(e->map, e->orig_len);
+}
+
+/* the saved file keeps the permissions of the one it replaces */
+static void copy_mode(const char *from, const char *to)
+{
+    struct stat st;
+    if (stat(from, &st) == 0) chmod(to, st.st_mode & 07777);
+}
+
+#else /* _WIN32 */
+
+static bool map_file(TUI_Editor *e, const char *path)
+{
+    if (!SDL_GetPathInfo(path, NULL)) return true;
+    size_t n;
+    void *m = SDL_LoadFile(path, &n);
+    if (!m) return false;
+    e->map      = m;
+    e->orig     = m;
+    e->orig_len = n;
+    return true;
+}
+
+static void unmap_file(TUI_Editor *e)
+{
+    SDL_free(e->map);
+}
+
+static void copy_mode(const char *from, const char *to)
+{
+    (void)from;
+    (void)to;
+}
+
+#endif /* _WIN32 */
+
+TUI_Editor *tui_editor_open(const char *path)
+{
+    TUI_Editor *e = calloc(1, sizeof *e);
+    if (!e) return NULL;
+    e->want_col = -1;
+    if (path && !map_file(e, path)) {
+        free(e);
+        return NULL;
+    }
+    e->nblk = (e->orig_len + ED_BLOCK - 1) / ED_BLOCK;
+    if (e->nblk && !(e->blk = malloc(e->nblk * sizeof *e->blk))) {
+        tui_editor_free(e);
+        return NULL;
+    }
+    for (size_t b = 0; b < e->nblk; b++) e->blk[b] = BLK_UNKNOWN;
+    if (e->orig_len) {
+        if (!grow((void **)&e->pc, &e->pc_cap, 1, sizeof(Piece))) {
+            tui_editor_free(e);
+            return NULL;
+        }
+        e->pc[0] = (Piece){SRC_ORIG, 0, e->orig_len, NL_UNKNOWN};
+        e->npc   = 1;
+        e->len   = e->orig_len;
+    }
+    return e;
+}
+
+static void drop_ops(TUI_Editor *e, int from)
+{
+    for (int i = from; i < e->nops; i++) {
+        free(e->ops[i].del);
+        free(e->ops[i].ins);
+    }
+    e->nops = from;
+}
+
+void tui_editor_free(TUI_Editor *e)
+{
+    if (!e) return;
+    drop_ops(e, 0);
+    free(e->ops);
+    free(e->pc);
+    free(e->blk);
+    free(e->add);
+    unmap_file(e);
+    free(e);
+}
+
+bool tui_editor_save(TUI_Editor *e, const char *path)
+{
+    char tmp[1024];
+    snprintf(tmp, sizeof tmp, "%s.tmp", path);
+    SDL_IOStream *io = SDL_IOFromFile(tmp, "wb");
+    if (!io) return false;
+    copy_mode(path, tmp);                 /* before the text is in it */
+    for (int i = 0; i < e->npc; i++) {
+        if (SDL_WriteIO(io, piece_ptr(e, &e->pc[i]), e->pc[i].len)
+            != e->pc[i].len) {
+            SDL_CloseIO(io);
+            SDL_RemovePath(tmp);
+            return false;
+        }
+    }
+    if (!SDL_CloseIO(io) || !SDL_RenamePath(tmp, path)) {
+        SDL_RemovePath(tmp);
+        return false;
+    }
+    /* the mapping still shows the old file, which is what pieces refer to */
+    e->saved = e->ndone;
+    e->seal  = true;
+    return true;
+}
+
+/* ── Editing ───────────────────────────────────────────── */
+
+static bool push_op(TUI_Editor *e, const EditOp *op)
+{
+    if (e->saved > e->ndone) e->saved = -1;     /* save point unreachable */
+    drop_ops(e, e->ndone);
+    if (!grow((void **)&e->ops, &e->ops_cap, e->nops + 1, sizeof(EditOp)))
+        return false;
+    e->ops[e->nops++] = *op;
+    e->ndone = e->nops;
+    e->seal  = false;
+    return true;
+}
+
+void tui_editor_insert(TUI_Editor *e, const char *text, size_t n)
+{
+    if (n == 0) return;
+    if (e->add_len + n > e->add_cap) {
+        size_t nc = e->add_cap ? e->add_cap : 4096;
+        while (nc < e->add_len + n) nc *= 2;
+        char *nb = realloc(e->add, nc);
+        if (!nb) return;
+        e->add     = nb;
+        e->add_cap = nc;
+    }
+    memcpy(e->add + e->add_len, text, n);
+    Piece p = {SRC_ADD, e->add_len, n, mem_count(text, n)};
+    e->add_len += n;
+
+    if (!splice(e, e->cursor, 0, &p, 1, NULL, NULL)) return;
+
+    /* typing continues the previous insert as one undo step */
+    EditOp *last = e->ndone ? &e->ops[e->ndone - 1] : NULL;
+    if (!e->seal && last && last->ndel == 0 && last->nins == 1
+        && e->ndone == e->nops
+        && last->pos + last->ins_len == e->cursor
+        && last->ins[0].off + last->ins[0].len == p.off) {
+        last->ins[0].len += n;
+        last->ins[0].nl  += p.nl;
+        last->ins_len    += n;
+    } else {
+        EditOp op = {e->cursor, NULL, malloc(sizeof(Piece)), 0, 1, 0, n};
+        if (!op.ins) return;
+        op.ins[0] = p;
+        push_op(e, &op);
+    }
+    e->cursor  += n;
+    e->want_col = -1;
+}
+
+static void erase(TUI_Editor *e, size_t from, size_t to)
+{
+    if (to <= from) return;
+    EditOp op = {from, NULL, NULL, 0, 0, to - from, 0};
+    if (!splice(e, from, to - from, NULL, 0, &op.del, &op.ndel)) return;
+    push_op(e, &op);
+    e->seal     = true;
+    e->cursor   = from;
+    e->want_col = -1;
+}
+
+bool tui_editor_undo(TUI_Editor *e)
+{
+    if (e->ndone == 0) return false;
+    EditOp *op = &e->ops[e->ndone - 1];
+    if (!splice(e, op->pos, op->ins_len, op->del, op->ndel, NULL, NULL))
+        return false;
+    e->ndone--;
+    e->cursor   = op->pos + op->del_len;
+    e->seal     = true;
+    e->want_col = -1;
+    return true;
+}
+
+bool tui_editor_redo(TUI_Editor *e)
+{
+    if (e->ndone == e->nops) return false;
+    EditOp *op = &e->ops[e->ndone];
+    if (!splice(e, op->pos, op->del_len, op->ins, op->nins, NULL, NULL))
+        return false;
+    e->ndone++;
+    e->cursor   = op->pos + op->ins_len;
+    e->seal     = true;
+    e->want_col = -1;
+    return true;
+}
+
+/* ── Navigation ────────────────────────────────────────── */
+
+static void move_lines(TUI_Editor *e, int n)
+{
+    size_t ls = line_start(e, e->cursor);
+    if (e->want_col < 0) e->want_col = pos_col(e, ls, e->cursor);
+    for (; n < 0 && ls > 0; n++) ls = line_start(e, ls - 1);
+    for (; n > 0; n--) {
+        size_t nx = next_line(e, ls);
+        if (nx == e->len && byte_at(e, nx - 1) != '\n') break;
+        ls = nx;
+    }
+    e->cursor = col_pos(e, ls, e->want_col);
+}
+
+bool tui_editor_handle(TUI_Editor *e, const SDL_Event *ev)
+{
+    if (ev->type == SDL_EVENT_TEXT_INPUT) {
+        tui_editor_insert(e, ev->text.text, strlen(ev->text.text));
+        return true;
+    }
+    if (ev->type != SDL_EVENT_KEY_DOWN) return false;
+
+    bool   ctrl = ev->key.mod & SDL_KMOD_CTRL;
+    size_t old  = e->cursor;
+    int    page = e->view_h > 1 ? e->view_h - 1 : 1;
+    switch (ev->key.key) {
+    case SDLK_RETURN:
+    case SDLK_KP_ENTER:  tui_editor_insert(e, "\n", 1); return true;
+    case SDLK_TAB:       tui_editor_insert(e, "\t", 1); return true;
+    case SDLK_BACKSPACE: erase(e, cp_prev(e, e->cursor), e->cursor); return true;
+    case SDLK_DELETE:    erase(e, e->cursor, cp_next(e, e->cursor)); return true;
+    case SDLK_LEFT:      e->cursor = cp_prev(e, e->cursor); e->want_col = -1; break;
+    case SDLK_RIGHT:     e->cursor = cp_next(e, e->cursor); e->want_col = -1; break;
+    case SDLK_UP:        move_lines(e, -1);    break;
+    case SDLK_DOWN:      move_lines(e, 1);     break;
+    case SDLK_PAGEUP:    move_lines(e, -page); break;
+    case SDLK_PAGEDOWN:  move_lines(e, page);  break;
+    case SDLK_HOME:
+        e->cursor   = ctrl ? 0 : line_start(e, e->cursor);
+        e->want_col = -1;
+        break;
+    case SDLK_END:
+        if (ctrl) {
+            e->cursor = e->len;
+        } else {
+            size_t nx = next_line(e, e->cursor);
+            e->cursor = nx > e->cursor && byte_at(e, nx - 1) == '\n'
+                      ? nx - 1 : nx;
+        }
+        e->want_col = -1;
+        break;
+    case SDLK_Z:
+        if (!ctrl) return false;
+        if (ev->key.mod & SDL_KMOD_SHIFT) tui_editor_redo(e);
+        else tui_editor_undo(e);
+        return true;
+    case SDLK_Y:
+        if (!ctrl) return false;
+        tui_editor_redo(e);
+        return true;
+    default:
+        return false;
+    }
+    if (e->cursor != old) e->seal = true;
+    return true;
+}
+
+/* ── Drawing ───────────────────────────────────────────── */
+
+/* scroll so the cursor line is one of the h rows below top */
+static void follow_cursor(TUI_Editor *e, int h)
+{
+    size_t cl = line_start(e, e->cursor);
+    size_t p  = e->top;
+    int    k  = 0;
+    if (cl < e->top) {
+        while (p > cl && k < h) p = line_start(e, p - 1), k++;
+        e->top_line = p == cl ? e->top_line - (size_t)k : line_at(e, cl);
+        e->top      = cl;
+        return;
+    }
+    while (p < cl && k < h) p = next_line(e, p), k++;
+    if (p == cl && k < h) return;
+
+    size_t line = p == cl ? e->top_line + (size_t)k : line_at(e, cl);
+    size_t q = cl;
+    int    m = 0;
+    while (q > 0 && m < h - 1) q = line_start(e, q - 1), m++;
+    e->top      = q;
+    e->top_line = line - (size_t)m;
+}
+
+void tui_draw_editor(TUI *t, int x, int y, int w, int h, TUI_Editor *e,
+                     bool focused, uint8_t fg, uint8_t bg,
+                     uint8_t cf, uint8_t cb)
+{
+    if (w < 1 || h < 1) return;
+    e->view_h = h;
+    index_some(e, ED_INDEX_STEP);
+
+    follow_cursor(e, h);
+    int col = pos_col(e, line_start(e, e->cursor), e->cursor);
+    if (col < e->left) e->left = col;
+    if (col >= e->left + w) e->left = col - w + 1;
+
+    tui_fill(t, x, y, w, h, ' ', fg, bg);
+    size_t ls = e->top;
+    for (int r = 0; r < h; r++) {
+        Iter it;
+        iter_init(&it, e, ls);
+        size_t pos = ls;
+        int c, cur = 0;
+        for (;;) {
+            bool at_cur = focused && pos == e->cursor && t->blink_on;
+            c = iter_next(&it);
+            if (c < 0 || c == '\n' || cur >= e->left + w) {
+                if (at_cur && cur >= e->left && cur < e->left + w)
+                    tui_putc(t, x + cur - e->left, y + r, ' ', cf, cb);
+                break;
+            }
+            pos++;
+            if (IS_CONT(c)) continue;
+            int nc = c == '\t' ? (cur / ED_TAB + 1) * ED_TAB : cur + 1;
+            char ch = c == '\t' ? ' ' : (c < 0x20 || c >= 0x7f) ? '?' : (char)c;
+            for (; cur < nc; cur++, at_cur = false)
+                if (cur >= e->left && cur < e->left + w)
+                    tui_putc(t, x + cur - e->left, y + r, ch,
+                             at_cur ? cf : fg, at_cur ? cb : bg);
+        }
+        if (c < 0) break;
+        ls = c == '\n' ? pos + 1 : next_line(e, pos);
+    }
+}
+
+/* ── Queries ───────────────────────────────────────────── */
+
+size_t tui_editor_length(const TUI_Editor *e)
+{
+    return e->len;
+}
+
+bool tui_editor_modified(const TUI_Editor *e)
+{
+    return e->ndone != e->saved;
+}
+
+void tui_editor_position(TUI_Editor *e, size_t *line, size_t *col)
+{
+    size_t ls = line_start(e, e->cursor);
+    if (line) *line = line_at(e, ls) + 1;
+    if (col)  *col  = (size_t)pos_col(e, ls, e->cursor) + 1;
+}
+
+bool tui_editor_lines(TUI_Editor *e, size_t *lines)
+{
+    if (e->blk_done < e->nblk) return false;
+    *lines = count_nl(e, 0, e->len) + 1;
+    return true;
+}
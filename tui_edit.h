@@ -0,0 +1,42 @@
+#ifndef TUI_EDIT_H
+#define TUI_EDIT_H
+
+#include "tui.h"
+
+/*
+ * Multi-line editor pane.
+ *
+ * The document is a piece table over the original file, which is mapped
+ * read-only and never copied, and an append-only buffer holding typed and
+ * pasted text.  Newlines in the original are counted per 64 KB block on
+ * demand (and a little more every frame), so opening is O(1) and moving
+ * around only scans what is on screen.  Each undo step records the pieces
+ * it removed and inserted, so undo and redo cost O(edit), not O(file).
+ *
+ * Bytes are shown one cell per code point; non-ASCII shows as '?' and tabs
+ * expand to the next multiple of four columns.
+ */
+
+typedef struct TUI_Editor TUI_Editor;
+
+TUI_Editor *tui_editor_open(const char *path);  /* NULL or missing: empty */
+void        tui_editor_free(TUI_Editor *e);
+bool        tui_editor_save(TUI_Editor *e, const char *path);
+
+void tui_draw_editor  (TUI *t, int x, int y, int w, int h, TUI_Editor *e,
+                       bool focused, uint8_t fg, uint8_t bg,
+                       uint8_t cur_fg, uint8_t cur_bg);
+bool tui_editor_handle(TUI_Editor *e, const SDL_Event *ev);
+
+void tui_editor_insert(TUI_Editor *e, const char *text, size_t n);
+bool tui_editor_undo  (TUI_Editor *e);
+bool tui_editor_redo  (TUI_Editor *e);
+
+size_t tui_editor_length  (const TUI_Editor *e);
+bool   tui_editor_modified(const TUI_Editor *e);
+/* 1-based line and column of the cursor */
+void   tui_editor_position(TUI_Editor *e, size_t *line, size_t *col);
+/* false while the newline index of the original is still being built */
+bool   tui_editor_lines   (TUI_Editor *e, size_t *lines);
+
+#endif /* TUI_EDIT_H */
@@ -0,0 +1,263 @@
+#include "tui_event.h"
+#include "tui_record.h"
+#include "tui_ansi.h"
+#include "tui_remote.h"
+#include <stdlib.h>
+#include <string.h>
+#include "tui_alloc.h"
+
+struct TUI_Events {
+    SDL_Event       q[TUI_EVENT_BATCH];     /* merged, not yet handed out */
+    size_t          text[TUI_EVENT_BATCH];  /* arena offset of a text event */
+    bool            typed[TUI_EVENT_BATCH]; /* key press whose text was
+                                               folded into an earlier one */
+    int             head, count;
+    char           *arena;                  /* strings of this batch */
+    size_t          used, cap;
+    bool            pumped;                 /* SDL_PumpEvents this frame */
+    bool            paired;                 /* the source sends a press
+                                               right before its text */
+    TUI_EventStats  stats;
+};
+
+/* ── Merging ───────────────────────────────────────────── */
+
+/* append a string with its terminator */
+static bool arena_put(TUI_Events *p, const char *s, size_t n)
+{
+    if (p->used + n + 1 > p->cap) {
+        size_t cap = p->cap ? p->cap * 2 : 256;
+        while (cap < p->used + n + 1) cap *= 2;
+        char *a = realloc(p->arena, cap);
+        if (!a) return false;
+        p->arena = a;
+        p->cap   = cap;
+    }
+    memcpy(p->arena + p->used, s, n);
+    p->arena[p->used + n] = '\0';
+    p->used += n + 1;
+    return true;
+}
+
+/* a press that types text, not one that edits or moves */
+static bool types_text(const SDL_Event *k)
+{
+    return !(k->key.key & SDLK_SCANCODE_MASK) && k->key.key >= 0x20
+        && k->key.key != SDLK_DELETE
+        && !(k->key.mod & (SDL_KMOD_CTRL | SDL_KMOD_ALT | SDL_KMOD_GUI));
+}
+
+/* the queued text event that e can extend, -1 if none: the last one, if
+   only key releases and presses that typed text follow it, then e's own
+   press.  In a window each typed character is a press, then its text;
+   other sources send text alone, so a press there always ends the run. */
+static int text_run(const TUI_Events *p, const SDL_Event *e)
+{
+    int end = p->head + p->count - 1;
+    if (end < p->head || !e->text.text) return -1;
+    int i = end;
+    const SDL_Event *k = &p->q[i];
+    if (p->paired && k->type == SDL_EVENT_KEY_DOWN && !p->typed[i]
+        && types_text(k) && k->key.windowID == e->text.windowID) i--;
+    for (; i >= p->head; i--) {
+        const SDL_Event *q = &p->q[i];
+        if (q->type == SDL_EVENT_TEXT_INPUT)
+            return q->text.windowID == e->text.windowID ? i : -1;
+        if (q->type == SDL_EVENT_KEY_UP) continue;
+        if (q->type == SDL_EVENT_KEY_DOWN && p->typed[i]) continue;
+        return -1;
+    }
+    return -1;
+}
+
+/* fold e into the last queued event if they are the same kind of run */
+static bool merge(TUI_Events *p, const SDL_Event *e)
+{
+    if (p->count == 0) return false;
+    int i = p->head + p->count - 1;
+    SDL_Event *l = &p->q[i];
+
+    if (e->type == SDL_EVENT_TEXT_INPUT) {
+        /* its string is the last one in the arena: extend it over its
+           terminator; the presses in between now come after it */
+        int k = text_run(p, e);
+        if (k < 0) return false;
+        p->used--;
+        if (!arena_put(p, e->text.text, strlen(e->text.text))) {
+            p->used++;
+            return false;
+        }
+        if (k != i) p->typed[i] = true;
+        p->q[k].common.timestamp = e->common.timestamp;
+        return true;
+    }
+    if (l->type != e->type) return false;
+
+    switch (e->type) {
+    case SDL_EVENT_MOUSE_MOTION:
+        if (l->motion.windowID != e->motion.windowID
+            || l->motion.state != e->motion.state) return false;
+        l->motion.x     = e->motion.x;
+        l->motion.y     = e->motion.y;
+        l->motion.xrel += e->motion.xrel;
+        l->motion.yrel += e->motion.yrel;
+        break;
+    case SDL_EVENT_WINDOW_RESIZED:
+    case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
+        if (l->window.windowID != e->window.windowID) return false;
+        l->window.data1 = e->window.data1;
+        l->window.data2 = e->window.data2;
+        break;
+    case SDL_EVENT_MOUSE_WHEEL:
+        if (l->wheel.windowID != e->wheel.windowID
+            || l->wheel.direction != e->wheel.direction) return false;
+        l->wheel.x         += e->wheel.x;
+        l->wheel.y         += e->wheel.y;
+        l->wheel.integer_x += e->wheel.integer_x;
+        l->wheel.integer_y += e->wheel.integer_y;
+        l->wheel.mouse_x    = e->wheel.mouse_x;
+        l->wheel.mouse_y    = e->wheel.mouse_y;
+        break;
+    default:
+        return false;
+    }
+    l->common.timestamp = e->common.timestamp;
+    return true;
+}
+
+static void add(TUI_Events *p, const SDL_Event *e)
+{
+    p->stats.received++;
+    if (merge(p, e)) return;
+    int i = p->head + p->count;
+    p->q[i] = *e;
+    p->typed[i] = false;
+    if (e->type == SDL_EVENT_TEXT_INPUT) {
+        /* sources reuse their text buffers, so keep a copy */
+        const char *s = e->text.text ? e->text.text : "";
+        p->text[i] = p->used;
+        if (!arena_put(p, s, strlen(s))) return;
+    }
+    p->count++;
+}
+
+/* ── Sources ───────────────────────────────────────────── */
+
+/* queue what the source has, up to a full batch; false if nothing came */
+static bool fill(TUI *t, TUI_Events *p)
+{
+    p->head = 0;
+    p->used = 0;
+    p->paired = !tui_replaying(t) && !t->ansi && !t->remote;
+
+    if (!p->paired) {
+        SDL_Event e;
+        while (p->count < TUI_EVENT_BATCH) {
+            bool got = tui_replaying(t) ? tui_replay_poll(t, &e)
+                     : t->ansi          ? tui_ansi_poll(t, &e)
+                     :                    tui_remote_poll(t, &e);
+            if (!got) break;
+            add(p, &e);
+        }
+    } else {
+        if (!p->pumped) {
+            SDL_PumpEvents();
+            p->pumped = true;
+        }
+        /* take only what fits: nothing waits here on SDL's text memory */
+        SDL_Event buf[TUI_EVENT_BATCH];
+        while (p->count < TUI_EVENT_BATCH) {
+            int n = SDL_PeepEvents(buf, TUI_EVENT_BATCH - p->count,
+                                   SDL_GETEVENT,
+                                   SDL_EVENT_FIRST, SDL_EVENT_LAST);
+            if (n <= 0) break;
+            for (int i = 0; i < n; i++) add(p, &buf[i]);
+        }
+    }
+    if (p->count == 0) return false;
+    p->stats.batches++;
+    return true;
+}
+
+/* take the i-th queued event out, as delivered */
+static void hand_out_at(TUI *t, TUI_Events *p, int i, SDL_Event *e)
+{
+    int at = p->head + i;
+    *e = p->q[at];
+    if (e->type == SDL_EVENT_TEXT_INPUT)
+        e->text.text = p->arena + p->text[at];
+    if (i == 0) {
+        p->head++;
+    } else {
+        int rest = p->count - i - 1;
+        memmove(&p->q[at],     &p->q[at + 1],     rest * sizeof *p->q);
+        memmove(&p->text[at],  &p->text[at + 1],  rest * sizeof *p->text);
+        memmove(&p->typed[at], &p->typed[at + 1], rest * sizeof *p->typed);
+    }
+    p->count--;
+    p->stats.delivered++;
+    if (t->rec) tui_record_event(t, e);
+}
+
+static void hand_out(TUI *t, TUI_Events *p, SDL_Event *e)
+{
+    hand_out_at(t, p, 0, e);
+}
+
+/* ── API ───────────────────────────────────────────────── */
+
+bool tui_poll_event(TUI *t, SDL_Event *e)
+{
+    TUI_Events *p = t->events;
+    if (!p) {
+        p = t->events = calloc(1, sizeof *p);
+        if (!p) return false;
+    }
+    if (p->count == 0 && !fill(t, p)) return false;
+    hand_out(t, p, e);
+    return true;
+}
+
+int tui_event_take_repeats(TUI *t, const SDL_Event *e)
+{
+    TUI_Events *p = t->events;
+    if (!p || e->type != SDL_EVENT_KEY_DOWN) return 0;
+    int n = 0;
+    SDL_Event skip;
+    for (;;) {
+        if (p->count == 0 && !fill(t, p)) break;
+        /* the text a typing key made stays queued for the text handler;
+           any other text between two presses stops the run */
+        int i = 0;
+        if (p->paired && types_text(e))
+            while (i < p->count
+                   && p->q[p->head + i].type == SDL_EVENT_TEXT_INPUT) i++;
+        if (i == p->count) break;
+        const SDL_Event *q = &p->q[p->head + i];
+        if (q->type != SDL_EVENT_KEY_DOWN || q->key.key != e->key.key
+            || q->key.mod != e->key.mod) break;
+        hand_out_at(t, p, i, &skip);
+        n++;
+    }
+    return n;
+}
+
+void tui_event_stats(const TUI *t, TUI_EventStats *out)
+{
+    memset(out, 0, sizeof *out);
+    if (t->events) *out = t->events->stats;
+}
+
+void tui_event_begin(TUI *t)
+{
+    /* even if the last loop stopped before the queue ran dry */
+    if (t->events) t->events->pumped = false;
+}
+
+void tui_event_close(TUI *t)
+{
+    if (!t->events) return;
+    free(t->events->arena);
+    free(t->events);
+    t->events = NULL;
+}
@@ -0,0 +1,48 @@
+#ifndef TUI_EVENT_H
+#define TUI_EVENT_H
+
+#include "tui.h"
+
+/*
+ * Event pump.
+ *
+ * tui_poll_event() replaces SDL_PollEvent in the application loop.  Each
+ * frame it drains its source in batches: SDL_PeepEvents after a single
+ * SDL_PumpEvents for a window, the tty or remote decoder, or a replay.
+ * It merges runs before handing the events out one by one:
+ *
+ *   consecutive mouse motion    the last position, relative motion summed
+ *   consecutive resizes         the last size
+ *   consecutive wheel events    their steps summed
+ *   runs of text input          one string, so a paste is one insertion
+ *
+ * In a window every typed character comes as a key press, then its text.
+ * Text runs across such presses (and key releases): the presses are kept
+ * but handed out after the merged text.  Any other press -- Return,
+ * Backspace, an arrow, or any press from the tty, a remote or a replay --
+ * ends the run.  Nothing else is dropped or reordered.  Key repeats are
+ * left as they are, but a handler that can apply a key several times at
+ * once may take the identical presses queued right behind it with
+ * tui_event_take_repeats(), which looks past the text a typing key made.
+ * Text pointers stay valid until the next call.
+ */
+
+#define TUI_EVENT_BATCH 64
+
+typedef struct {
+    uint64_t received;           /* from the source */
+    uint64_t delivered;          /* handed out, repeats taken included */
+    uint64_t batches;            /* refills of the queue */
+} TUI_EventStats;
+
+bool tui_poll_event        (TUI *t, SDL_Event *e);
+/* removes the presses of e's key (same modifiers) queued right behind e
+   and returns how many; they are recorded as if handled one by one */
+int  tui_event_take_repeats(TUI *t, const SDL_Event *e);
+void tui_event_stats       (const TUI *t, TUI_EventStats *out);
+
+/* hooks used by tui_begin and tui_destroy */
+void tui_event_begin(TUI *t);
+void tui_event_close(TUI *t);
+
+#endif /* TUI_EVENT_H */
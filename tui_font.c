@@ -0,0 +1,429 @@
+#include "tui_font.h"
+#include "tui_stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tui_alloc.h"
+
+#define FONT_MAX_ZOOM 8
+
+typedef struct {
+    char         *path;
+    float         size;
+    int           zoom;         /* 1: a new font, else a native zoom level */
+    int           gen;          /* font generation a zoom atlas belongs to */
+
+    TTF_Font     *font;         /* results, kept for zoom 1 only */
+    SDL_Surface  *surf;
+    int           cell_w, cell_h;
+    char          err[128];
+} Build;
+
+struct TUI_FontCache {
+    int           refs;
+    char         *path;         /* face and size of font */
+    float         size;
+    int           gen;          /* bumped when a new font is installed */
+    TTF_Font     *font;
+
+    SDL_Surface  *base;         /* atlas at size, uploaded by every window */
+    int           base_w, base_h;
+    SDL_Surface  *zoom[FONT_MAX_ZOOM + 1];   /* native atlases by level */
+    int           zoom_w[FONT_MAX_ZOOM + 1], zoom_h[FONT_MAX_ZOOM + 1];
+
+    SDL_Thread   *thread;       /* running `run` */
+    SDL_AtomicInt done;
+    Build        *run, *next;   /* next: latest request not yet started */
+    char          err[128];
+};
+
+/* one window's textures of the cache's atlases */
+struct TUI_Fonts {
+    TUI_FontCache *cache;
+    int            gen;         /* of the cache the textures were made from */
+    bool           native;
+    SDL_Texture   *base;
+    SDL_Texture   *zoom[FONT_MAX_ZOOM + 1];
+};
+
+/* ── Library ───────────────────────────────────────────── */
+
+/* windows and caches each hold a reference; UI thread only */
+static int lib_refs;
+
+bool tui_lib_acquire(void)
+{
+    if (lib_refs == 0) {
+        if (!SDL_Init(SDL_INIT_VIDEO)) return false;
+        if (!TTF_Init()) {
+            SDL_Quit();
+            return false;
+        }
+    }
+    lib_refs++;
+    return true;
+}
+
+void tui_lib_release(void)
+{
+    if (lib_refs == 0 || --lib_refs > 0) return;
+    TTF_Quit();
+    SDL_Quit();
+}
+
+/* ── Rasterizing ───────────────────────────────────────── */
+
+static SDL_Surface *render_atlas(TTF_Font *font, int cw, int ch)
+{
+    SDL_Color white = {255, 255, 255, 255};
+    char buf[2] = "M";
+
+    SDL_Surface *ref = TTF_RenderText_Blended(font, buf, 0, white);
+    if (!ref) return NULL;
+    SDL_PixelFormat fmt = ref->format;
+    SDL_DestroySurface(ref);
+
+    int count = TUI_ATLAS_ASCII + TUI_ATLAS_BLOCKS;
+    SDL_Surface *atlas = SDL_CreateSurface(cw * count, ch, fmt);
+    if (!atlas) return NULL;
+    SDL_FillSurfaceRect(atlas, NULL,
+                        SDL_MapSurfaceRGBA(atlas, 0, 0, 0, 0));
+
+    for (int i = 0; i < TUI_ATLAS_ASCII; i++) {
+        buf[0] = (char)(32 + i);
+        SDL_Surface *g = TTF_RenderText_Blended(font, buf, 0, white);
+        if (g) {
+            SDL_SetSurfaceBlendMode(g, SDL_BLENDMODE_NONE);
+            SDL_Rect d = {i * cw, 0, g->w, g->h};
+            SDL_BlitSurface(g, NULL, atlas, &d);
+            SDL_DestroySurface(g);
+        }
+    }
+    /* blocks are drawn, not taken from the font, so they tile exactly */
+    Uint32 solid = SDL_MapSurfaceRGBA(atlas, 255, 255, 255, 255);
+    for (int k = 1; k <= TUI_ATLAS_BLOCKS; k++) {
+        int h = (ch * k + TUI_ATLAS_BLOCKS / 2) / TUI_ATLAS_BLOCKS;
+        SDL_Rect r = {(TUI_ATLAS_ASCII + k - 1) * cw, ch - h, cw, h};
+        SDL_FillSurfaceRect(atlas, &r, solid);
+    }
+    return atlas;
+}
+
+/* open, measure and rasterize; on any thread */
+static bool build(Build *b)
+{
+    b->font = TTF_OpenFont(b->path, b->size);
+    if (!b->font) goto fail;
+    TTF_GetStringSize(b->font, "M", 0, &b->cell_w, &b->cell_h);
+    if (b->cell_w <= 0 || b->cell_h <= 0) {
+        SDL_SetError("%s has no usable cell size", b->path);
+        goto fail;
+    }
+    b->surf = render_atlas(b->font, b->cell_w, b->cell_h);
+    if (!b->surf) goto fail;
+    if (b->zoom != 1) {
+        TTF_CloseFont(b->font);
+        b->font = NULL;
+    }
+    return true;
+
+fail:
+    snprintf(b->err, sizeof b->err, "%s", SDL_GetError());
+    if (b->font) TTF_CloseFont(b->font);
+    b->font = NULL;
+    return false;
+}
+
+static SDL_Texture *upload(TUI *t, SDL_Surface *surf)
+{
+    SDL_Texture *tex = SDL_CreateTextureFromSurface(t->renderer, surf);
+    if (!tex) return NULL;
+    TUI_COUNT(t, upload_bytes, (size_t)surf->pitch * (size_t)surf->h);
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST);
+    return tex;
+}
+
+static void build_free(Build *b)
+{
+    if (!b) return;
+    if (b->font) TTF_CloseFont(b->font);
+    if (b->surf) SDL_DestroySurface(b->surf);
+    free(b->path);
+    free(b);
+}
+
+/* ── Worker ────────────────────────────────────────────── */
+
+static int build_main(void *data)
+{
+    TUI_FontCache *c = data;
+    build(c->run);
+    SDL_SetAtomicInt(&c->done, 1);
+    return 0;
+}
+
+static void start(TUI_FontCache *c)
+{
+    if (c->thread || !c->next) return;
+    c->run  = c->next;
+    c->next = NULL;
+    SDL_SetAtomicInt(&c->done, 0);
+    c->thread = SDL_CreateThread(build_main, "tui_font", c);
+    if (!c->thread) {
+        build(c->run);                /* no thread: build it here */
+        SDL_SetAtomicInt(&c->done, 1);
+    }
+}
+
+static bool request(TUI_FontCache *c, const char *path, float size, int zoom)
+{
+    /* a zoom atlas never displaces a waiting font change */
+    if (zoom != 1 && c->next && c->next->zoom == 1) return true;
+    Build *b = calloc(1, sizeof *b);
+    if (!b) return SDL_SetError("out of memory");
+    b->path = SDL_strdup(path);
+    if (!b->path) {
+        free(b);
+        return SDL_SetError("out of memory");
+    }
+    b->size = size;
+    b->zoom = zoom;
+    b->gen  = c->gen;
+    build_free(c->next);
+    c->next = b;
+    start(c);
+    return true;
+}
+
+static bool queued(const TUI_FontCache *c, int zoom)
+{
+    return (c->run  && c->run->zoom  == zoom && c->run->gen  == c->gen)
+        || (c->next && c->next->zoom == zoom && c->next->gen == c->gen);
+}
+
+/* ── Cache ─────────────────────────────────────────────── */
+
+static void drop_surfaces(TUI_FontCache *c)
+{
+    for (int z = 0; z <= FONT_MAX_ZOOM; z++) {
+        if (c->zoom[z]) SDL_DestroySurface(c->zoom[z]);
+        c->zoom[z] = NULL;
+    }
+}
+
+/* take a finished build's surface into the cache */
+static void install(TUI_FontCache *c, Build *b)
+{
+    if (!b->surf) {
+        snprintf(c->err, sizeof c->err, "%s", b->err);
+        return;
+    }
+    if (b->zoom != 1 && b->gen != c->gen) return;     /* font changed */
+    c->err[0] = '\0';
+
+    if (b->zoom != 1) {
+        c->zoom[b->zoom]   = b->surf;
+        c->zoom_w[b->zoom] = b->cell_w;
+        c->zoom_h[b->zoom] = b->cell_h;
+        b->surf = NULL;
+        return;
+    }
+
+    drop_surfaces(c);
+    if (c->base) SDL_DestroySurface(c->base);
+    c->base   = b->surf;
+    c->base_w = b->cell_w;
+    c->base_h = b->cell_h;
+    b->surf   = NULL;
+    if (c->font) TTF_CloseFont(c->font);
+    c->font   = b->font;
+    b->font   = NULL;
+    free(c->path);
+    c->path   = b->path;
+    b->path   = NULL;
+    c->size   = b->size;
+    c->gen++;
+}
+
+static void cache_poll(TUI_FontCache *c)
+{
+    if (!c->thread || !SDL_GetAtomicInt(&c->done)) return;
+    SDL_WaitThread(c->thread, NULL);
+    c->thread = NULL;
+    Build *b = c->run;
+    c->run = NULL;
+    install(c, b);
+    build_free(b);
+    start(c);
+}
+
+TUI_FontCache *tui_font_cache_new(const char *path, float size)
+{
+    if (!tui_lib_acquire()) return NULL;
+    TUI_FontCache *c = calloc(1, sizeof *c);
+    Build b = {.size = size, .zoom = 1};
+    if (!c) {
+        SDL_SetError("out of memory");
+        goto fail;
+    }
+    c->path = SDL_strdup(path);
+    if (!c->path) {
+        SDL_SetError("out of memory");
+        goto fail;
+    }
+    b.path = c->path;
+    if (!build(&b)) goto fail;
+    c->refs   = 1;
+    c->size   = size;
+    c->font   = b.font;
+    c->base   = b.surf;
+    c->base_w = b.cell_w;
+    c->base_h = b.cell_h;
+    return c;
+
+fail:
+    if (c) free(c->path);
+    free(c);
+    /* releasing the last reference quits SDL, which forgets the error */
+    char err[128];
+    snprintf(err, sizeof err, "%s", SDL_GetError());
+    tui_lib_release();
+    SDL_SetError("%s", err);
+    return NULL;
+}
+
+TUI_FontCache *tui_font_cache_ref(TUI_FontCache *c)
+{
+    if (c) c->refs++;
+    return c;
+}
+
+void tui_font_cache_free(TUI_FontCache *c)
+{
+    if (!c || --c->refs > 0) return;
+    if (c->thread) SDL_WaitThread(c->thread, NULL);
+    build_free(c->run);
+    build_free(c->next);
+    drop_surfaces(c);
+    if (c->base) SDL_DestroySurface(c->base);
+    if (c->font) TTF_CloseFont(c->font);
+    free(c->path);
+    free(c);
+    tui_lib_release();
+}
+
+TUI_FontCache *tui_font_cache(const TUI *t)
+{
+    return t->fonts ? t->fonts->cache : NULL;
+}
+
+/* ── Window ────────────────────────────────────────────── */
+
+static void drop_textures(TUI_Fonts *f)
+{
+    for (int z = 0; z <= FONT_MAX_ZOOM; z++) {
+        if (f->zoom[z]) SDL_DestroyTexture(f->zoom[z]);
+        f->zoom[z] = NULL;
+    }
+}
+
+/* bring the window's textures up to date and pick the atlas for t->zoom */
+static void sync(TUI *t)
+{
+    TUI_Fonts     *f = t->fonts;
+    TUI_FontCache *c = f->cache;
+    int zoom = t->zoom;
+
+    if (f->gen != c->gen || !f->base) {
+        drop_textures(f);
+        if (f->base) SDL_DestroyTexture(f->base);
+        f->base = upload(t, c->base);
+        f->gen  = c->gen;
+        t->font = c->font;
+        if (!f->base) snprintf(c->err, sizeof c->err, "%s", SDL_GetError());
+    }
+
+    t->scale = zoom;
+    if (f->native && zoom > 1 && zoom <= FONT_MAX_ZOOM) {
+        if (!f->zoom[zoom] && c->zoom[zoom])
+            f->zoom[zoom] = upload(t, c->zoom[zoom]);
+        if (f->zoom[zoom]) {
+            t->atlas  = f->zoom[zoom];
+            t->cell_w = c->zoom_w[zoom];
+            t->cell_h = c->zoom_h[zoom];
+            t->scale  = 1;
+            return;
+        }
+        if (!c->zoom[zoom] && !queued(c, zoom))
+            request(c, c->path, c->size * (float)zoom, zoom);
+    }
+    t->atlas  = f->base;
+    t->cell_w = c->base_w;
+    t->cell_h = c->base_h;
+}
+
+/* ── API ───────────────────────────────────────────────── */
+
+bool tui_font_open(TUI *t, TUI_FontCache *c)
+{
+    TUI_Fonts *f = calloc(1, sizeof *f);
+    if (!f) return SDL_SetError("out of memory");
+    f->cache = tui_font_cache_ref(c);
+    t->fonts = f;
+    sync(t);
+    return t->atlas != NULL;
+}
+
+void tui_font_zoom(TUI *t, int zoom)
+{
+    t->zoom  = zoom;
+    t->scale = zoom;
+    if (t->fonts) sync(t);
+}
+
+void tui_font_poll(TUI *t)
+{
+    if (!t->fonts) return;
+    cache_poll(t->fonts->cache);
+    sync(t);
+}
+
+void tui_font_close(TUI *t)
+{
+    TUI_Fonts *f = t->fonts;
+    if (!f) return;
+    drop_textures(f);
+    if (f->base) SDL_DestroyTexture(f->base);
+    tui_font_cache_free(f->cache);
+    free(f);
+    t->fonts = NULL;
+    t->font  = NULL;
+    t->atlas = NULL;
+}
+
+bool tui_set_font(TUI *t, const char *path, float size)
+{
+    if (!t->fonts || !t->renderer) return SDL_SetError("no window");
+    return request(t->fonts->cache, path, size, 1);
+}
+
+void tui_set_native_zoom(TUI *t, bool on)
+{
+    if (!t->fonts) return;
+    t->fonts->native = on;
+    if (!on) drop_textures(t->fonts);
+    tui_font_zoom(t, t->zoom);
+}
+
+bool tui_font_busy(const TUI *t)
+{
+    const TUI_FontCache *c = tui_font_cache(t);
+    return c && (c->thread || c->next);
+}
+
+const char *tui_font_error(const TUI *t)
+{
+    const TUI_FontCache *c = tui_font_cache(t);
+    return c && c->err[0] ? c->err : NULL;
+}
@@ -0,0 +1,59 @@
+#ifndef TUI_FONT_H
+#define TUI_FONT_H
+
+#include "tui.h"
+
+/*
+ * Font atlases, shared between windows and rebuilt in the background.
+ *
+ * A TUI_FontCache holds one face and size: the TTF_Font and its atlas, one
+ * row of glyph cells rasterized into a surface.  Each window keeps only its
+ * own textures, uploaded from the cache's surfaces, so a second window
+ * showing the same font costs one texture upload and no rasterizing.
+ * tui_init() makes a cache for its window alone; tui_init_shared() draws
+ * with an existing one, such as tui_font_cache() of another window.
+ *
+ * tui_set_font() rasterizes the new face or size on a worker thread.  The
+ * old atlas keeps rendering until tui_begin() finds the result and swaps it
+ * in; every window of the cache then uploads it on its next tui_begin()
+ * and its grid follows the new cell size.
+ *
+ * Zoom normally magnifies the atlas with nearest-neighbour filtering.
+ * With native zoom on, each zoom level also gets an atlas rasterized at
+ * size * zoom, built the same way and kept until the font changes, so
+ * zoomed text is crisp.  Until it is ready the magnified atlas is shown.
+ *
+ * While a build runs only its worker uses SDL_ttf; the UI thread opens no
+ * fonts after the cache is made and closes old ones only once the worker
+ * is done.  Windows and caches share one reference count on SDL and
+ * SDL_ttf, so they are initialized with the first and quit with the last.
+ * Caches and windows belong to the UI thread.
+ */
+
+/* atlas layout: printable ASCII 32..126, then the eight blocks */
+#define TUI_ATLAS_ASCII  95
+#define TUI_ATLAS_BLOCKS 8
+
+/* rasterizes the first atlas before returning; NULL on failure */
+TUI_FontCache *tui_font_cache_new (const char *path, float size);
+TUI_FontCache *tui_font_cache_ref (TUI_FontCache *c);
+void           tui_font_cache_free(TUI_FontCache *c);   /* drops a reference */
+TUI_FontCache *tui_font_cache     (const TUI *t);       /* the window's cache */
+
+/* changes the font of every window sharing t's cache.  A newer request
+   replaces one that has not started; false if there is no window to draw
+   with, build failures are reported by tui_font_error() */
+bool        tui_set_font       (TUI *t, const char *path, float size);
+void        tui_set_native_zoom(TUI *t, bool on);     /* per window */
+bool        tui_font_busy      (const TUI *t);   /* a build queued or running */
+const char *tui_font_error     (const TUI *t);   /* last failed build, or NULL */
+
+/* hooks used by tui_init_shared / tui_set_scale / tui_begin / tui_destroy */
+bool tui_lib_acquire(void);
+void tui_lib_release(void);
+bool tui_font_open  (TUI *t, TUI_FontCache *c);
+void tui_font_zoom  (TUI *t, int zoom);
+void tui_font_poll  (TUI *t);
+void tui_font_close (TUI *t);
+
+#endif /* TUI_FONT_H */
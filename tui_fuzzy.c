@@ -0,0 +1,375 @@
+#include "tui_fuzzy.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "tui_alloc.h"
+
+#define FZ_QUERY_MAX  128
+#define FZ_PAR_MIN    16384       /* candidates before threads pay off */
+#define FZ_THREADS    8
+
+typedef struct { int score, idx; } Hit;
+
+typedef struct {
+    const TUI_Fuzzy *f;
+    const int  *src;              /* candidates to test, or NULL: a..b */
+    int         a, b;
+    int        *out;              /* matches, in candidate order */
+    int         nout;
+    Hit         top[TUI_FUZZY_TOP];
+    int         ntop;
+} Slice;
+
+struct TUI_Fuzzy {
+    const char *const *items;
+    int         n;
+    uint64_t   *mask;
+    int        *match, *spare;    /* current matches, in candidate order */
+    int         nmatch;
+    Hit         top[TUI_FUZZY_TOP];
+    int         ntop;
+    Slice       sl[FZ_THREADS];
+
+    char        query[FZ_QUERY_MAX];
+    int         qlen;
+    uint64_t    qmask;
+    bool        icase;
+
+    TUI_InputState input;
+    int         selected, scroll, confirmed;
+    bool        escaped;
+};
+
+/* ── Matching ──────────────────────────────────────────── */
+
+static int fold(int c)
+{
+    return c >= 'A' && c <= 'Z' ? c + 32 : c;
+}
+
+static uint64_t char_bit(int c)
+{
+    c = fold(c);
+    if (c >= 'a' && c <= 'z') return 1ull << (c - 'a');
+    if (c >= '0' && c <= '9') return 1ull << (26 + c - '0');
+    return 1ull << (36 + c % 28);
+}
+
+static uint64_t str_mask(const char *s)
+{
+    uint64_t m = 0;
+    for (; *s; s++) m |= char_bit((unsigned char)*s);
+    return m;
+}
+
+static bool is_boundary(const char *s, int i)
+{
+    if (i == 0) return true;
+    char p = s[i - 1], c = s[i];
+    return p == ' ' || p == '_' || p == '-' || p == '/' || p == '.'
+        || p == ':' || (p >= 'a' && p <= 'z' && c >= 'A' && c <= 'Z');
+}
+
+/* Score of s for the query, or -1.  A forward pass finds where the first
+   subsequence match ends, a backward pass from there the shortest window;
+   pos (if set) receives the matched offsets inside that window. */
+static int score(const TUI_Fuzzy *f, const char *s, int *pos)
+{
+    const char *q = f->query;
+    int qn = f->qlen, i = 0, k = 0;
+    if (qn == 0) return 0;                /* keep the caller's order */
+    for (; s[i] && k < qn; i++) {
+        int c = (unsigned char)s[i];
+        if ((f->icase ? fold(c) : c) == (unsigned char)q[k]) k++;
+    }
+    if (k < qn) return -1;
+    int end = i, len = i;
+    while (s[len]) len++;
+
+    int start = end;
+    for (k = qn - 1; k >= 0; start--) {
+        int c = (unsigned char)s[start - 1];
+        if ((f->icase ? fold(c) : c) == (unsigned char)q[k]) k--;
+    }
+
+    int sc = 0, prev = -2;
+    k = 0;
+    for (i = start; i < end && k < qn; i++) {
+        int c = (unsigned char)s[i];
+        if ((f->icase ? fold(c) : c) != (unsigned char)q[k]) continue;
+        sc += 16;
+        if (prev == i - 1) sc += 8;
+        if (is_boundary(s, i)) sc += 10;
+        if (pos) pos[k] = i;
+        prev = i;
+        k++;
+    }
+    sc -= (end - start) - qn;            /* gaps inside the window */
+    sc -= start / 4 + len / 16;          /* earlier and shorter is better */
+    return sc;
+}
+
+/* min-heap on rank: the worst kept hit is at top[0] */
+static bool worse(Hit a, Hit b)
+{
+    return a.score < b.score || (a.score == b.score && a.idx > b.idx);
+}
+
+static void top_push(Hit *top, int *n, Hit h)
+{
+    int i;
+    if (*n == TUI_FUZZY_TOP) {
+        if (!worse(top[0], h)) return;
+        top[0] = h;
+        for (i = 0;;) {                                 /* sift down */
+            int l = 2 * i + 1, r = l + 1, m = i;
+            if (l < *n && worse(top[l], top[m])) m = l;
+            if (r < *n && worse(top[r], top[m])) m = r;
+            if (m == i) break;
+            Hit tmp = top[i];
+            top[i] = top[m];
+            top[m] = tmp;
+            i = m;
+        }
+        return;
+    }
+    for (i = (*n)++; i > 0 && worse(h, top[(i - 1) / 2]); i = (i - 1) / 2)
+        top[i] = top[(i - 1) / 2];
+    top[i] = h;
+}
+
+static int slice_main(void *data)
+{
+    Slice *s = data;
+    const TUI_Fuzzy *f = s->f;
+    s->nout = s->ntop = 0;
+    for (int j = s->a; j < s->b; j++) {
+        int idx = s->src ? s->src[j] : j;
+        if ((f->mask[idx] & f->qmask) != f->qmask) continue;
+        int sc = score(f, f->items[idx], NULL);
+        if (sc < 0) continue;
+        s->out[s->nout++] = idx;
+        top_push(s->top, &s->ntop, (Hit){sc, idx});
+    }
+    return 0;
+}
+
+static int cmp_hit(const void *a, const void *b)
+{
+    Hit x = *(const Hit *)a, y = *(const Hit *)b;
+    return worse(x, y) ? 1 : worse(y, x) ? -1 : 0;
+}
+
+static void run(TUI_Fuzzy *f, const int *src, int nsrc)
+{
+    Slice *sl = f->sl;
+    SDL_Thread *th[FZ_THREADS] = {0};
+    int nt = 1;
+    if (nsrc >= FZ_PAR_MIN) {
+        nt = SDL_GetNumLogicalCPUCores();
+        if (nt > FZ_THREADS) nt = FZ_THREADS;
+        if (nt < 1) nt = 1;
+    }
+    for (int i = 0; i < nt; i++) {
+        sl[i].f   = f;
+        sl[i].src = src;
+        sl[i].a   = (int)((int64_t)nsrc * i / nt);
+        sl[i].b   = (int)((int64_t)nsrc * (i + 1) / nt);
+        sl[i].out = f->spare + sl[i].a;
+        if (i > 0) th[i] = SDL_CreateThread(slice_main, "tui_fuzzy", &sl[i]);
+        if (i > 0 && !th[i]) slice_main(&sl[i]);
+    }
+    slice_main(&sl[0]);
+
+    /* slices are in candidate order, so concatenating keeps it */
+    int n = 0;
+    f->ntop = 0;
+    for (int i = 0; i < nt; i++) {
+        if (th[i]) SDL_WaitThread(th[i], NULL);
+        memmove(f->spare + n, sl[i].out, (size_t)sl[i].nout * sizeof(int));
+        n += sl[i].nout;
+        for (int k = 0; k < sl[i].ntop; k++)
+            top_push(f->top, &f->ntop, sl[i].top[k]);
+    }
+    qsort(f->top, (size_t)f->ntop, sizeof(Hit), cmp_hit);
+
+    int *t = f->match;
+    f->match  = f->spare;
+    f->spare  = t;
+    f->nmatch = n;
+}
+
+/* ── API ───────────────────────────────────────────────── */
+
+TUI_Fuzzy *tui_fuzzy_new(void)
+{
+    TUI_Fuzzy *f = calloc(1, sizeof *f);
+    if (!f) return NULL;
+    tui_input_init(&f->input, FZ_QUERY_MAX - 1);
+    f->confirmed = -1;
+    return f;
+}
+
+void tui_fuzzy_free(TUI_Fuzzy *f)
+{
+    if (!f) return;
+    free(f->mask);
+    free(f->match);
+    free(f->spare);
+    tui_input_free(&f->input);
+    free(f);
+}
+
+bool tui_fuzzy_set(TUI_Fuzzy *f, const char *const *items, int n)
+{
+    uint64_t *mask  = malloc((size_t)(n ? n : 1) * sizeof *mask);
+    int      *match = malloc((size_t)(n ? n : 1) * sizeof *match);
+    int      *spare = malloc((size_t)(n ? n : 1) * sizeof *spare);
+    if (!mask || !match || !spare) {
+        free(mask);
+        free(match);
+        free(spare);
+        return false;
+    }
+    free(f->mask);
+    free(f->match);
+    free(f->spare);
+    f->mask  = mask;
+    f->match = match;
+    f->spare = spare;
+    f->items = items;
+    f->n     = n;
+    for (int i = 0; i < n; i++) f->mask[i] = str_mask(items[i]);
+
+    tui_input_clear(&f->input);
+    f->selected  = f->scroll = 0;
+    f->confirmed = -1;
+    f->escaped   = false;
+    f->qlen      = -1;                      /* force a full pass */
+    tui_fuzzy_query(f, "");
+    return true;
+}
+
+void tui_fuzzy_query(TUI_Fuzzy *f, const char *query)
+{
+    int qn = (int)strlen(query);
+    if (qn >= FZ_QUERY_MAX) qn = FZ_QUERY_MAX - 1;
+    bool extends = f->qlen >= 0 && qn >= f->qlen
+                && memcmp(query, f->query, (size_t)f->qlen) == 0;
+    if (extends && qn == f->qlen) return;
+
+    bool icase = true;
+    for (int i = 0; i < qn; i++)
+        if (query[i] >= 'A' && query[i] <= 'Z') icase = false;
+    for (int i = 0; i < qn; i++)
+        f->query[i] = icase ? (char)fold((unsigned char)query[i]) : query[i];
+    f->query[qn] = '\0';
+    f->qlen  = qn;
+    f->icase = icase;
+    f->qmask = str_mask(f->query);
+    if (strcmp(tui_input_text(&f->input), query) != 0) {
+        tui_input_clear (&f->input);
+        tui_input_insert(&f->input, query, qn);
+    }
+
+    /* a longer query only ever matches a subset of the shorter one */
+    if (extends) run(f, f->match, f->nmatch);
+    else         run(f, NULL, f->n);
+    f->selected = f->scroll = 0;
+}
+
+int tui_fuzzy_count(const TUI_Fuzzy *f)
+{
+    return f->nmatch;
+}
+
+int tui_fuzzy_result(const TUI_Fuzzy *f, int rank)
+{
+    return rank >= 0 && rank < f->ntop ? f->top[rank].idx : -1;
+}
+
+int tui_fuzzy_confirmed(const TUI_Fuzzy *f)
+{
+    return f->confirmed;
+}
+
+bool tui_fuzzy_escaped(const TUI_Fuzzy *f)
+{
+    return f->escaped;
+}
+
+bool tui_fuzzy_handle(TUI_Fuzzy *f, const SDL_Event *e)
+{
+    f->confirmed = -1;
+    if (e->type == SDL_EVENT_KEY_DOWN) {
+        bool ctrl = e->key.mod & SDL_KMOD_CTRL;
+        switch (e->key.key) {
+        case SDLK_UP:
+            if (f->selected > 0) f->selected--;
+            return true;
+        case SDLK_DOWN:
+            if (f->selected + 1 < f->ntop) f->selected++;
+            return true;
+        case SDLK_R:
+            if (!ctrl) break;
+            if (f->selected + 1 < f->ntop) f->selected++;
+            return true;
+        case SDLK_RETURN:
+        case SDLK_KP_ENTER:
+            f->confirmed = tui_fuzzy_result(f, f->selected);
+            return true;
+        case SDLK_ESCAPE:
+            f->escaped = true;
+            return true;
+        default:
+            break;
+        }
+    }
+    if (!tui_input_handle(&f->input, e)) return false;
+    tui_fuzzy_query(f, tui_input_text(&f->input));
+    return true;
+}
+
+void tui_draw_fuzzy(TUI *t, int x, int y, int w, int h, TUI_Fuzzy *f,
+                    const char *title, uint8_t fg, uint8_t bg,
+                    uint8_t sf, uint8_t sb, uint8_t hf)
+{
+    if (w < 8 || h < 4) return;
+    tui_fill(t, x, y, w, h, ' ', fg, bg);
+    tui_box (t, x, y, w, h, fg, bg);
+    if (title) {
+        int tl = (int)strlen(title);
+        tui_puts(t, x + (w - tl) / 2, y, title, fg, bg);
+    }
+
+    char count[32];
+    snprintf(count, sizeof count, " %d/%d ", f->nmatch, f->n);
+    int cl = (int)strlen(count);
+    tui_puts(t, x + w - cl - 1, y + h - 1, count, fg, bg);
+
+    tui_putc(t, x + 1, y + 1, '>', fg, bg);
+    tui_draw_input(t, x + 2, y + 1, w - 3, &f->input, true,
+                   fg, bg, bg, fg);
+
+    int vis = h - 3;
+    if (f->selected < f->scroll) f->scroll = f->selected;
+    if (f->selected >= f->scroll + vis) f->scroll = f->selected - vis + 1;
+
+    /* matched characters are recomputed for the visible rows only */
+    int pos[FZ_QUERY_MAX];
+    for (int r = 0; r < vis && f->scroll + r < f->ntop; r++) {
+        int rank = f->scroll + r;
+        const char *s = f->items[f->top[rank].idx];
+        bool sel = rank == f->selected;
+        uint8_t rf = sel ? sf : fg, rb = sel ? sb : bg;
+        tui_fill(t, x + 1, y + 2 + r, w - 2, 1, ' ', rf, rb);
+        if (score(f, s, pos) < 0) continue;
+        int k = 0;
+        for (int c = 0; c < w - 3 && s[c]; c++) {
+            bool hit = k < f->qlen && pos[k] == c;
+            if (hit) k++;
+            tui_putc(t, x + 2 + c, y + 2 + r, s[c],
+                     hit ? hf : rf, rb);
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef TUI_FUZZY_H
+#define TUI_FUZZY_H
+
+#include "tui.h"
+
+/*
+ * Fuzzy finder popup.
+ *
+ * Candidates are matched as subsequences of the query (case-insensitive
+ * unless the query has capitals) and ranked by a score that rewards
+ * consecutive characters and word starts.  Every candidate carries a 64-bit
+ * mask of the characters it contains, so most non-matches are rejected with
+ * one AND.  When the query is extended only the previous matches are
+ * re-scored, and large sets are split across threads.  The best
+ * TUI_FUZZY_TOP matches are kept in rank order; earlier candidates win ties.
+ */
+
+#define TUI_FUZZY_TOP 256
+
+typedef struct TUI_Fuzzy TUI_Fuzzy;
+
+TUI_Fuzzy *tui_fuzzy_new (void);
+void       tui_fuzzy_free(TUI_Fuzzy *f);
+
+/* items must stay valid until the next tui_fuzzy_set; resets the query */
+bool tui_fuzzy_set  (TUI_Fuzzy *f, const char *const *items, int n);
+/* also replaces the text in the popup's input line */
+void tui_fuzzy_query(TUI_Fuzzy *f, const char *query);
+int  tui_fuzzy_count (const TUI_Fuzzy *f);            /* all matches */
+int  tui_fuzzy_result(const TUI_Fuzzy *f, int rank);  /* item, or -1 */
+
+void tui_draw_fuzzy  (TUI *t, int x, int y, int w, int h, TUI_Fuzzy *f,
+                      const char *title, uint8_t fg, uint8_t bg,
+                      uint8_t sel_fg, uint8_t sel_bg, uint8_t hl_fg);
+bool tui_fuzzy_handle(TUI_Fuzzy *f, const SDL_Event *e);
+int  tui_fuzzy_confirmed(const TUI_Fuzzy *f);         /* item, or -1 */
+bool tui_fuzzy_escaped  (const TUI_Fuzzy *f);
+
+#endif /* TUI_FUZZY_H */
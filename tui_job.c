@@ -0,0 +1,347 @@
+#include "tui_job.h"
+#include <stdlib.h>
+#include <string.h>
+#include "tui_alloc.h"
+
+#define JOB_MAX_WORKERS 16
+
+struct TUI_Job {
+    TUI_Job      *next;             /* completion list */
+    TUI_JobFn     fn;
+    TUI_JobDone   done;
+    void         *user;
+    TUI_JobToken *tok;
+    int           gen;
+    bool          cancelled;        /* as it returned, for done */
+    uint64_t      submit_ns;
+};
+
+typedef struct {
+    TUI_JobPool  *pool;
+    int           index;
+    SDL_Thread   *thread;
+    SDL_ThreadID  id;
+
+    SDL_Mutex    *lock;             /* deque and stats */
+    TUI_Job     **ring;
+    int           cap, head, count;
+    uint64_t      submitted, completed, stolen;
+    uint64_t      wait_us_total, wait_us_max, run_us_total, run_us_max;
+} Worker;
+
+struct TUI_JobPool {
+    Worker        w[JOB_MAX_WORKERS];
+    int           nw;
+    SDL_AtomicInt queued, rr;
+
+    SDL_Mutex    *idle_lock;
+    SDL_Condition *idle_cond;
+    int           started;
+    bool          ready, stop;
+
+    uint32_t      event;
+    SDL_AtomicInt posted;
+    SDL_Mutex    *done_lock;
+    TUI_Job      *done_head, *done_tail;
+};
+
+/* ── Deques ────────────────────────────────────────────── */
+
+static bool push_back(Worker *w, TUI_Job *j)
+{
+    if (w->count == w->cap) {
+        int cap = w->cap ? w->cap * 2 : 64;
+        TUI_Job **ring = malloc((size_t)cap * sizeof *ring);
+        if (!ring) return false;
+        for (int i = 0; i < w->count; i++)
+            ring[i] = w->ring[(w->head + i) % w->cap];
+        free(w->ring);
+        w->ring = ring;
+        w->cap  = cap;
+        w->head = 0;
+    }
+    w->ring[(w->head + w->count++) % w->cap] = j;
+    w->submitted++;
+    return true;
+}
+
+static int worker_index(const TUI_JobPool *p)
+{
+    SDL_ThreadID self = SDL_GetCurrentThreadID();
+    for (int i = 0; i < p->nw; i++)
+        if (p->w[i].id == self) return i;
+    return -1;
+}
+
+/* newest from our own deque, else the oldest from someone else's */
+static TUI_Job *take(TUI_JobPool *p, int self, bool *stolen)
+{
+    TUI_Job *j = NULL;
+    if (self >= 0) {
+        Worker *w = &p->w[self];
+        SDL_LockMutex(w->lock);
+        if (w->count > 0) j = w->ring[(w->head + --w->count) % w->cap];
+        SDL_UnlockMutex(w->lock);
+    }
+    int start = self >= 0 ? self + 1 : SDL_AddAtomicInt(&p->rr, 1);
+    for (int k = 0; !j && k < p->nw; k++) {
+        int i = (int)((unsigned)(start + k) % (unsigned)p->nw);
+        if (i == self) continue;
+        Worker *w = &p->w[i];
+        SDL_LockMutex(w->lock);
+        if (w->count > 0) {
+            j = w->ring[w->head];
+            w->head = (w->head + 1) % w->cap;
+            w->count--;
+            *stolen = self >= 0;
+        }
+        SDL_UnlockMutex(w->lock);
+    }
+    if (j) SDL_AddAtomicInt(&p->queued, -1);
+    return j;
+}
+
+static void run_job(TUI_JobPool *p, TUI_Job *j, int self, bool stolen)
+{
+    uint64_t start = SDL_GetTicksNS();
+    j->fn(j, j->user);
+    uint64_t end = SDL_GetTicksNS();
+    j->cancelled = tui_job_cancelled(j);
+
+    /* threads helping in tui_job_wait book their work to worker 0 */
+    Worker *w = &p->w[self >= 0 ? self : 0];
+    uint64_t wait = (start - j->submit_ns) / 1000, run = (end - start) / 1000;
+    SDL_LockMutex(w->lock);
+    w->completed++;
+    w->stolen        += stolen;
+    w->wait_us_total += wait;
+    w->run_us_total  += run;
+    if (wait > w->wait_us_max) w->wait_us_max = wait;
+    if (run  > w->run_us_max)  w->run_us_max  = run;
+    SDL_UnlockMutex(w->lock);
+
+    /* the token may be gone as soon as pending drops */
+    if (j->tok) SDL_AddAtomicInt(&j->tok->pending, -1);
+    if (!j->done) {
+        free(j);
+        return;
+    }
+    j->next = NULL;
+    SDL_LockMutex(p->done_lock);
+    if (p->done_tail) p->done_tail->next = j;
+    else              p->done_head = j;
+    p->done_tail = j;
+    SDL_UnlockMutex(p->done_lock);
+
+    if (p->event && SDL_CompareAndSwapAtomicInt(&p->posted, 0, 1)) {
+        SDL_Event e;
+        memset(&e, 0, sizeof e);
+        e.type = p->event;
+        SDL_PushEvent(&e);
+    }
+}
+
+/* ── Workers ───────────────────────────────────────────── */
+
+static int worker_main(void *data)
+{
+    Worker *w = data;
+    TUI_JobPool *p = w->pool;
+
+    SDL_LockMutex(p->idle_lock);
+    w->id = SDL_GetCurrentThreadID();
+    p->started++;
+    SDL_BroadcastCondition(p->idle_cond);
+    while (!p->ready) SDL_WaitCondition(p->idle_cond, p->idle_lock);
+    SDL_UnlockMutex(p->idle_lock);
+
+    for (;;) {
+        bool stolen = false;
+        TUI_Job *j = take(p, w->index, &stolen);
+        if (j) {
+            run_job(p, j, w->index, stolen);
+            continue;
+        }
+        SDL_LockMutex(p->idle_lock);
+        while (SDL_GetAtomicInt(&p->queued) == 0 && !p->stop)
+            SDL_WaitCondition(p->idle_cond, p->idle_lock);
+        bool done = p->stop && SDL_GetAtomicInt(&p->queued) == 0;
+        SDL_UnlockMutex(p->idle_lock);
+        if (done) break;
+    }
+    return 0;
+}
+
+/* ── API ───────────────────────────────────────────────── */
+
+TUI_JobPool *tui_job_pool_new(int workers)
+{
+    TUI_JobPool *p = calloc(1, sizeof *p);
+    if (!p) return NULL;
+    p->idle_lock = SDL_CreateMutex();
+    p->idle_cond = SDL_CreateCondition();
+    p->done_lock = SDL_CreateMutex();
+    if (!p->idle_lock || !p->idle_cond || !p->done_lock) goto fail;
+    p->event = SDL_RegisterEvents(1);
+
+    if (workers <= 0) workers = SDL_GetNumLogicalCPUCores() - 1;
+    if (workers < 1) workers = 1;
+    if (workers > JOB_MAX_WORKERS) workers = JOB_MAX_WORKERS;
+    for (int i = 0; i < workers; i++) {
+        Worker *w = &p->w[p->nw];
+        w->pool  = p;
+        w->index = p->nw;
+        w->lock  = SDL_CreateMutex();
+        if (!w->lock) break;
+        w->thread = SDL_CreateThread(worker_main, "tui_job", w);
+        if (!w->thread) {
+            SDL_DestroyMutex(w->lock);
+            w->lock = NULL;
+            break;
+        }
+        p->nw++;
+    }
+    if (p->nw == 0) goto fail;
+
+    /* workers wait until every id is known and nw is final */
+    SDL_LockMutex(p->idle_lock);
+    while (p->started < p->nw) SDL_WaitCondition(p->idle_cond, p->idle_lock);
+    p->ready = true;
+    SDL_BroadcastCondition(p->idle_cond);
+    SDL_UnlockMutex(p->idle_lock);
+    return p;
+
+fail:
+    if (p->idle_lock) SDL_DestroyMutex(p->idle_lock);
+    if (p->idle_cond) SDL_DestroyCondition(p->idle_cond);
+    if (p->done_lock) SDL_DestroyMutex(p->done_lock);
+    free(p);
+    return NULL;
+}
+
+void tui_job_pool_free(TUI_JobPool *p)
+{
+    if (!p) return;
+    SDL_LockMutex(p->idle_lock);
+    p->stop = true;
+    SDL_BroadcastCondition(p->idle_cond);
+    SDL_UnlockMutex(p->idle_lock);
+    for (int i = 0; i < p->nw; i++) SDL_WaitThread(p->w[i].thread, NULL);
+
+    tui_job_pump(p);
+    for (int i = 0; i < p->nw; i++) {
+        free(p->w[i].ring);
+        SDL_DestroyMutex(p->w[i].lock);
+    }
+    SDL_DestroyMutex(p->idle_lock);
+    SDL_DestroyCondition(p->idle_cond);
+    SDL_DestroyMutex(p->done_lock);
+    free(p);
+}
+
+bool tui_job_submit(TUI_JobPool *p, TUI_JobFn fn, TUI_JobDone done,
+                    void *user, TUI_JobToken *tok)
+{
+    TUI_Job *j = calloc(1, sizeof *j);
+    if (!j) return SDL_SetError("out of memory");
+    j->fn        = fn;
+    j->done      = done;
+    j->user      = user;
+    j->tok       = tok;
+    j->submit_ns = SDL_GetTicksNS();
+    if (tok) {
+        j->gen = SDL_GetAtomicInt(&tok->gen);
+        SDL_AddAtomicInt(&tok->pending, 1);
+    }
+
+    int self = worker_index(p);
+    Worker *w = &p->w[self >= 0
+        ? self : (int)((unsigned)SDL_AddAtomicInt(&p->rr, 1) % (unsigned)p->nw)];
+    SDL_AddAtomicInt(&p->queued, 1);
+    SDL_LockMutex(w->lock);
+    bool ok = push_back(w, j);
+    SDL_UnlockMutex(w->lock);
+    if (!ok) {
+        SDL_AddAtomicInt(&p->queued, -1);
+        if (tok) SDL_AddAtomicInt(&tok->pending, -1);
+        free(j);
+        return SDL_SetError("out of memory");
+    }
+
+    SDL_LockMutex(p->idle_lock);
+    SDL_SignalCondition(p->idle_cond);
+    SDL_UnlockMutex(p->idle_lock);
+    return true;
+}
+
+bool tui_job_cancelled(const TUI_Job *j)
+{
+    return j->tok && SDL_GetAtomicInt(&j->tok->gen) != j->gen;
+}
+
+void tui_job_cancel(TUI_JobToken *tok)
+{
+    SDL_AddAtomicInt(&tok->gen, 1);
+}
+
+void tui_job_wait(TUI_JobPool *p, TUI_JobToken *tok)
+{
+    int self = worker_index(p);
+    while (SDL_GetAtomicInt(&tok->pending) > 0) {
+        bool stolen = false;
+        TUI_Job *j = take(p, self, &stolen);
+        if (j) run_job(p, j, self, stolen);
+        else   SDL_Delay(1);
+    }
+}
+
+uint32_t tui_job_event(const TUI_JobPool *p)
+{
+    return p->event;
+}
+
+bool tui_job_handle_event(TUI_JobPool *p, const SDL_Event *e)
+{
+    if (!p->event || e->type != p->event) return false;
+    tui_job_pump(p);
+    return true;
+}
+
+int tui_job_pump(TUI_JobPool *p)
+{
+    /* re-arm before taking the list, so later completions post again */
+    SDL_SetAtomicInt(&p->posted, 0);
+    SDL_LockMutex(p->done_lock);
+    TUI_Job *j = p->done_head;
+    p->done_head = p->done_tail = NULL;
+    SDL_UnlockMutex(p->done_lock);
+
+    int n = 0;
+    while (j) {
+        TUI_Job *next = j->next;
+        j->done(j->user, j->cancelled);
+        free(j);
+        j = next;
+        n++;
+    }
+    return n;
+}
+
+void tui_job_stats(TUI_JobPool *p, TUI_JobStats *out)
+{
+    memset(out, 0, sizeof *out);
+    out->workers = p->nw;
+    for (int i = 0; i < p->nw; i++) {
+        Worker *w = &p->w[i];
+        SDL_LockMutex(w->lock);
+        out->queued        += w->count;
+        out->submitted     += w->submitted;
+        out->completed     += w->completed;
+        out->stolen        += w->stolen;
+        out->wait_us_total += w->wait_us_total;
+        out->run_us_total  += w->run_us_total;
+        if (w->wait_us_max > out->wait_us_max) out->wait_us_max = w->wait_us_max;
+        if (w->run_us_max  > out->run_us_max)  out->run_us_max  = w->run_us_max;
+        SDL_UnlockMutex(w->lock);
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef TUI_JOB_H
+#define TUI_JOB_H
+
+#include "tui.h"
+
+/*
+ * Job pool for background work.
+ *
+ * Each worker owns a deque: jobs submitted from a worker go to the back of
+ * its own deque and it takes them back from there, while idle workers
+ * steal from the front of the others.  Jobs submitted from other threads
+ * are dealt round-robin.
+ *
+ * A job may have a completion callback.  It never runs on a worker: it is
+ * queued and an SDL user event of type tui_job_event() is pushed, so a
+ * loop blocked in SDL_WaitEvent wakes up; tui_job_handle_event() or
+ * tui_job_pump() then runs the callbacks on the calling (UI) thread.
+ *
+ * A TUI_JobToken groups jobs for cancellation and waiting.  Cancelling it
+ * marks every job submitted with it so far; jobs still run, and should
+ * return early when tui_job_cancelled() says so.
+ */
+
+typedef struct TUI_JobPool TUI_JobPool;
+typedef struct TUI_Job     TUI_Job;
+
+typedef struct {
+    SDL_AtomicInt gen;              /* bumped by tui_job_cancel      */
+    SDL_AtomicInt pending;          /* submitted, not yet returned   */
+} TUI_JobToken;                     /* zero-initialise               */
+
+typedef void (*TUI_JobFn)  (TUI_Job *j, void *user);
+typedef void (*TUI_JobDone)(void *user, bool cancelled);
+
+typedef struct {
+    int      workers;
+    int      queued;                /* waiting in deques now         */
+    uint64_t submitted, completed, stolen;
+    uint64_t wait_us_total, wait_us_max;   /* submit to start        */
+    uint64_t run_us_total,  run_us_max;
+} TUI_JobStats;
+
+/* workers <= 0: one per logical core, minus one for the UI thread */
+TUI_JobPool *tui_job_pool_new (int workers);
+/* finishes queued jobs, then runs outstanding completions */
+void         tui_job_pool_free(TUI_JobPool *p);
+
+/* tok and done may be NULL */
+bool tui_job_submit   (TUI_JobPool *p, TUI_JobFn fn, TUI_JobDone done,
+                       void *user, TUI_JobToken *tok);
+bool tui_job_cancelled(const TUI_Job *j);
+void tui_job_cancel   (TUI_JobToken *tok);
+/* until every job of tok has returned, running queued jobs meanwhile */
+void tui_job_wait     (TUI_JobPool *p, TUI_JobToken *tok);
+
+uint32_t tui_job_event       (const TUI_JobPool *p);
+bool     tui_job_handle_event(TUI_JobPool *p, const SDL_Event *e);
+int      tui_job_pump        (TUI_JobPool *p);   /* completions run */
+void     tui_job_stats       (TUI_JobPool *p, TUI_JobStats *out);
+
+#endif /* TUI_JOB_H */
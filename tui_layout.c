@@ -0,0 +1,157 @@
+#include "tui_layout.h"
+#include "tui_stats.h"
+#include <stdlib.h>
+#include <string.h>
+#include "tui_alloc.h"
+
+/* what an undrawn cell holds while baking; no primitive writes it */
+static const TUI_Cell HOLE = {'\0', 0xff, 0xff};
+
+typedef struct { uint32_t at, n; } Run;
+
+struct TUI_Layout {
+    TUI_LayoutDraw draw;
+    void          *user;
+
+    bool           baked;
+    int            cols, rows, scale, zoom;     /* baked for */
+    TUI_Cell      *cells;
+    TUI_Id        *ids;
+    size_t         cap;                         /* cells */
+    bool           any_id;
+
+    Run           *runs;
+    int            nruns, rcap;
+
+    SDL_Rect       field[TUI_LAYOUT_FIELDS];
+    uint32_t       marked;                      /* bit per field */
+};
+
+TUI_Layout *tui_layout_new(TUI_LayoutDraw draw, void *user)
+{
+    TUI_Layout *l = calloc(1, sizeof *l);
+    if (!l) return NULL;
+    l->draw = draw;
+    l->user = user;
+    return l;
+}
+
+void tui_layout_free(TUI_Layout *l)
+{
+    if (!l) return;
+    free(l->cells);
+    free(l->ids);
+    free(l->runs);
+    free(l);
+}
+
+void tui_layout_invalidate(TUI_Layout *l)
+{
+    l->baked = false;
+}
+
+/* ── Baking ────────────────────────────────────────────── */
+
+static bool is_hole(const TUI_Cell *c)
+{
+    return c->ch == HOLE.ch && c->fg == HOLE.fg && c->bg == HOLE.bg;
+}
+
+static bool add_run(TUI_Layout *l, uint32_t at, uint32_t n)
+{
+    if (l->nruns == l->rcap) {
+        int cap = l->rcap ? l->rcap * 2 : 16;
+        Run *r = realloc(l->runs, (size_t)cap * sizeof *r);
+        if (!r) return false;
+        l->runs = r;
+        l->rcap = cap;
+    }
+    l->runs[l->nruns++] = (Run){at, n};
+    return true;
+}
+
+/* run the callback into the layout's own grid and index what it drew */
+static bool bake(TUI *t, TUI_Layout *l)
+{
+    size_t n = (size_t)t->cols * (size_t)t->rows;
+    if (n > l->cap) {
+        TUI_Cell *c = realloc(l->cells, n * sizeof *c);
+        if (c) l->cells = c;
+        TUI_Id *d = realloc(l->ids, n * sizeof *d);
+        if (d) l->ids = d;
+        if (!c || !d) return false;
+        l->cap = n;
+    }
+    for (size_t i = 0; i < n; i++) l->cells[i] = HOLE;
+    memset(l->ids, 0, n * sizeof *l->ids);
+
+    TUI_Cell *cells = t->cells;
+    TUI_Id   *ids   = t->ids, id = t->id;
+    t->cells = l->cells;
+    t->ids   = l->ids;               /* so tui_set_id does not allocate */
+    t->id    = 0;
+    l->marked = 0;
+    l->draw(t, l, l->user);
+    t->cells = cells;
+    t->ids   = ids;
+    t->id    = id;
+
+    /* runs over the flat grid: a drawn span that ends a row and one that
+       starts the next are a single copy */
+    l->nruns  = 0;
+    l->any_id = false;
+    for (size_t i = 0; i < n; ) {
+        if (is_hole(&l->cells[i])) { i++; continue; }
+        size_t s = i;
+        while (i < n && !is_hole(&l->cells[i])) {
+            if (l->ids[i]) l->any_id = true;
+            i++;
+        }
+        if (!add_run(l, (uint32_t)s, (uint32_t)(i - s))) return false;
+    }
+    l->cols  = t->cols;
+    l->rows  = t->rows;
+    l->scale = t->scale;
+    l->zoom  = t->zoom;
+    return true;
+}
+
+/* ── Stamping ──────────────────────────────────────────── */
+
+void tui_layout_stamp(TUI *t, TUI_Layout *l)
+{
+    if (!l->baked || l->cols != t->cols || l->rows != t->rows
+        || l->scale != t->scale || l->zoom != t->zoom) {
+        l->baked = bake(t, l);
+        if (!l->baked) {
+            l->marked = 0;
+            l->draw(t, l, l->user);
+            return;
+        }
+    }
+    if (l->any_id && !t->ids) tui_set_id(t, t->id);   /* allocates */
+    for (int k = 0; k < l->nruns; k++) {
+        const Run *r = &l->runs[k];
+        memcpy(t->cells + r->at, l->cells + r->at, r->n * sizeof *t->cells);
+        if (t->ids)
+            memcpy(t->ids + r->at, l->ids + r->at, r->n * sizeof *t->ids);
+        TUI_COUNT(t, cells_written, r->n);
+    }
+}
+
+/* ── Fields ────────────────────────────────────────────── */
+
+void tui_layout_mark(TUI_Layout *l, int id, int x, int y, int w, int h)
+{
+    if (id < 0 || id >= TUI_LAYOUT_FIELDS) return;
+    l->field[id] = (SDL_Rect){x, y, w, h};
+    l->marked |= 1u << id;
+}
+
+bool tui_layout_field(const TUI_Layout *l, int id, SDL_Rect *r)
+{
+    if (id < 0 || id >= TUI_LAYOUT_FIELDS || !(l->marked & 1u << id))
+        return false;
+    *r = l->field[id];
+    return true;
+}
@@ -0,0 +1,44 @@
+#ifndef TUI_LAYOUT_H
+#define TUI_LAYOUT_H
+
+#include "tui.h"
+
+/*
+ * Baked layouts: static chrome drawn once, stamped every frame.
+ *
+ * A layout's draw callback makes the usual tui_* calls.  They are run
+ * into a private grid the first time the layout is stamped, and again
+ * only after the grid size or the zoom changed or the layout was
+ * invalidated.  The cells the callback drew are kept as runs, so
+ * stamping is one memcpy per run: a row each for a title bar or a rule,
+ * a single one when the callback fills the whole grid.  Cells it did not
+ * draw are holes and keep what the frame drew there before.  Widget ids
+ * set while baking are stamped with the cells.
+ *
+ * Fields name rectangles worked out while baking (a clock right-aligned
+ * in the title bar, the inside of a box) for the frame to draw its
+ * dynamic content into.
+ */
+
+#define TUI_LAYOUT_FIELDS 16
+
+typedef struct TUI_Layout TUI_Layout;
+
+/* draws the static part of a screen; t is as large as the real grid */
+typedef void (*TUI_LayoutDraw)(TUI *t, TUI_Layout *l, void *user);
+
+TUI_Layout *tui_layout_new (TUI_LayoutDraw draw, void *user);
+void        tui_layout_free(TUI_Layout *l);
+/* what the callback draws has changed: bake again at the next stamp */
+void        tui_layout_invalidate(TUI_Layout *l);
+
+/* bakes if needed, then copies the baked cells into the frame; without
+   memory to bake the callback draws straight into the frame instead */
+void tui_layout_stamp(TUI *t, TUI_Layout *l);
+
+/* inside the callback: field id (below TUI_LAYOUT_FIELDS) is this rect */
+void tui_layout_mark (TUI_Layout *l, int id, int x, int y, int w, int h);
+/* false if the last bake did not mark field id */
+bool tui_layout_field(const TUI_Layout *l, int id, SDL_Rect *r);
+
+#endif /* TUI_LAYOUT_H */
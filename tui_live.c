@@ -0,0 +1,277 @@
+#include "tui_live.h"
+#include "tui_utf8.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tui_alloc.h"
+
+#define TEXT_MAX 24
+
+/* C_SHOWN: the cell holds a value, C_STALE: its text is not formatted yet */
+enum { C_DIRTY = 1, C_SHOWN = 2, C_STALE = 4 };
+
+typedef struct {
+    SDL_AtomicU32 seq;                  /* pos + 1 when filled, pos + cap free */
+    uint32_t      cell;
+    double        v;
+} Slot;
+
+typedef struct {
+    double    value, shown;
+    uint64_t  flash_until;
+    uint8_t   flags;
+    int8_t    dir;                      /* of the last change */
+    uint8_t   len;
+    char      text[TEXT_MAX];
+} Cell;
+
+typedef struct {
+    char title[TEXT_MAX];
+    char fmt[16];
+    int  width;
+} Column;
+
+struct TUI_Live {
+    SDL_AtomicU32  tail;                /* producers */
+    char           pad[64 - sizeof(SDL_AtomicU32)];
+    SDL_AtomicInt  dropped;
+
+    Slot          *ring;
+    uint32_t       cap;                 /* power of two */
+    uint32_t       head;                /* UI thread from here on */
+
+    int            rows, cols;
+    Cell          *cells;
+    uint32_t      *dirty;               /* cells updated since the last pass */
+    int            ndirty;
+    Column         col[TUI_TABLE_MAX_COLS];
+
+    int            flash_ms;
+    uint8_t        up_bg, down_bg;
+    uint64_t       now;
+
+    uint64_t       posted, coalesced;
+    int            last_dirty, last_changed;
+};
+
+TUI_Live *tui_live_new(int rows, int cols, int queue)
+{
+    if (rows <= 0 || cols <= 0 || cols > TUI_TABLE_MAX_COLS) {
+        SDL_SetError("live table: bad size %dx%d", rows, cols);
+        return NULL;
+    }
+    TUI_Live *lt = calloc(1, sizeof *lt);
+    if (!lt) return NULL;
+    lt->cap = 64;
+    while (lt->cap < (uint32_t)queue && lt->cap < (1u << 30)) lt->cap <<= 1;
+    lt->rows  = rows;
+    lt->cols  = cols;
+    lt->ring  = malloc(lt->cap * sizeof *lt->ring);
+    lt->cells = calloc((size_t)rows * cols, sizeof *lt->cells);
+    lt->dirty = malloc((size_t)rows * cols * sizeof *lt->dirty);
+    if (!lt->ring || !lt->cells || !lt->dirty) {
+        tui_live_free(lt);
+        return NULL;
+    }
+    for (uint32_t i = 0; i < lt->cap; i++)
+        SDL_SetAtomicU32(&lt->ring[i].seq, i);
+    for (int c = 0; c < cols; c++)
+        tui_live_column(lt, c, "", 10, "%.2f");
+    lt->flash_ms = 300;
+    lt->up_bg    = TUI_GREEN;
+    lt->down_bg  = TUI_RED;
+    return lt;
+}
+
+void tui_live_free(TUI_Live *lt)
+{
+    if (!lt) return;
+    free(lt->ring);
+    free(lt->cells);
+    free(lt->dirty);
+    free(lt);
+}
+
+/* ── Setup ─────────────────────────────────────────────── */
+
+void tui_live_column(TUI_Live *lt, int col, const char *title, int width,
+                     const char *fmt)
+{
+    if (col < 0 || col >= lt->cols) return;
+    Column *c = &lt->col[col];
+    snprintf(c->title, sizeof c->title, "%s", title ? title : "");
+    snprintf(c->fmt, sizeof c->fmt, "%s", fmt ? fmt : "%.2f");
+    c->width = width > 0 ? width : 1;
+}
+
+void tui_live_text(TUI_Live *lt, int row, int col, const char *s)
+{
+    if (row < 0 || row >= lt->rows || col < 0 || col >= lt->cols) return;
+    Cell *c = &lt->cells[(size_t)row * lt->cols + col];
+    int n = snprintf(c->text, sizeof c->text, "%s", s ? s : "");
+    c->len   = (uint8_t)(n < TEXT_MAX ? n : TEXT_MAX - 1);
+    c->flags &= (uint8_t)~(C_SHOWN | C_STALE);
+    c->flash_until = 0;
+}
+
+void tui_live_flash(TUI_Live *lt, int ms, uint8_t up_bg, uint8_t down_bg)
+{
+    lt->flash_ms = ms > 0 ? ms : 0;
+    lt->up_bg    = up_bg;
+    lt->down_bg  = down_bg;
+}
+
+/* ── Queue ─────────────────────────────────────────────── */
+
+bool tui_live_post(TUI_Live *lt, int row, int col, double v)
+{
+    if (row < 0 || row >= lt->rows || col < 0 || col >= lt->cols) return false;
+    Uint32 pos = SDL_GetAtomicU32(&lt->tail);
+    for (;;) {
+        Slot *s = &lt->ring[pos & (lt->cap - 1)];
+        int32_t d = (int32_t)(SDL_GetAtomicU32(&s->seq) - pos);
+        if (d == 0) {
+            if (SDL_CompareAndSwapAtomicU32(&lt->tail, pos, pos + 1)) {
+                s->cell = (uint32_t)row * (uint32_t)lt->cols + (uint32_t)col;
+                s->v    = v;
+                SDL_SetAtomicU32(&s->seq, pos + 1);
+                return true;
+            }
+        } else if (d < 0) {
+            /* the consumer has not freed this slot yet: full */
+            SDL_AddAtomicInt(&lt->dropped, 1);
+            return false;
+        }
+        pos = SDL_GetAtomicU32(&lt->tail);
+    }
+}
+
+/* take at most one ring's worth, so producers that keep up cannot stretch
+   a frame; what is left waits for the next one */
+static void drain(TUI_Live *lt)
+{
+    for (uint32_t k = 0; k < lt->cap; k++) {
+        Slot *s = &lt->ring[lt->head & (lt->cap - 1)];
+        if (SDL_GetAtomicU32(&s->seq) != lt->head + 1) break;
+        uint32_t i = s->cell;
+        double   v = s->v;
+        SDL_SetAtomicU32(&s->seq, lt->head + lt->cap);
+        lt->head++;
+        lt->posted++;
+
+        Cell *c = &lt->cells[i];
+        c->value = v;
+        if (c->flags & C_DIRTY) { lt->coalesced++; continue; }
+        c->flags |= C_DIRTY;
+        lt->dirty[lt->ndirty++] = i;
+    }
+}
+
+int tui_live_update(TUI_Live *lt)
+{
+    lt->now = SDL_GetTicks();
+    drain(lt);
+
+    int changed = 0;
+    for (int k = 0; k < lt->ndirty; k++) {
+        uint32_t i = lt->dirty[k];
+        Cell *c = &lt->cells[i];
+        c->flags &= (uint8_t)~C_DIRTY;
+        bool had = c->flags & C_SHOWN;
+        if (had && c->value == c->shown) continue;
+
+        if (had) {
+            c->dir = c->value > c->shown ? 1 : -1;
+            c->flash_until = lt->now + (uint64_t)lt->flash_ms;
+        }
+        c->shown  = c->value;
+        c->flags |= C_SHOWN | C_STALE;
+        changed++;
+    }
+    lt->last_dirty   = lt->ndirty;
+    lt->last_changed = changed;
+    lt->ndirty = 0;
+    return changed;
+}
+
+void tui_live_stats(TUI_Live *lt, TUI_LiveStats *out)
+{
+    out->posted    = lt->posted;
+    out->dropped   = (unsigned)SDL_GetAtomicInt(&lt->dropped);
+    out->coalesced = lt->coalesced;
+    out->dirty     = lt->last_dirty;
+    out->changed   = lt->last_changed;
+}
+
+/* ── Drawing ───────────────────────────────────────────── */
+
+/* text is formatted when a cell is drawn, so rows scrolled out of view
+   cost nothing however often they change */
+static void format(TUI_Live *lt, Cell *c, int col)
+{
+    int n = snprintf(c->text, sizeof c->text, lt->col[col].fmt, c->shown);
+    c->len = (uint8_t)(n < 0 ? 0 : n < TEXT_MAX ? n : TEXT_MAX - 1);
+    c->flags &= (uint8_t)~C_STALE;
+}
+
+static void sep(TUI *t, int x, int y, const TUI_Live *lt,
+                uint8_t fg, uint8_t bg)
+{
+    int cx = x;
+    tui_putc(t, cx++, y, '+', fg, bg);
+    for (int c = 0; c < lt->cols; c++) {
+        tui_hline(t, cx, y, lt->col[c].width + 2, '-', fg, bg);
+        cx += lt->col[c].width + 2;
+        tui_putc(t, cx++, y, '+', fg, bg);
+    }
+}
+
+/* one cell padded to w; values to the right, text to the left */
+static void cell(TUI *t, int x, int y, int w, const char *s, int n,
+                 bool right, uint8_t fg, uint8_t bg)
+{
+    int tw  = tui_utf8_width(s, n);
+    int pad = right && tw < w ? w - tw : 0;
+    tui_hline(t, x, y, w + 2, ' ', fg, bg);
+    if (n) tui_puts_clip(t, x + 1 + pad, y, w - pad, s, fg, bg);
+}
+
+int tui_draw_live(TUI *t, int x, int y, TUI_Live *lt, int first, int count,
+                  uint8_t fg, uint8_t bg, uint8_t hdr_fg, uint8_t hdr_bg)
+{
+    tui_live_update(lt);
+    if (first < 0) first = 0;
+    if (count > lt->rows - first) count = lt->rows - first;
+
+    int cy = y;
+    sep(t, x, cy++, lt, fg, bg);
+    int cx = x;
+    tui_putc(t, cx++, cy, '|', fg, bg);
+    for (int c = 0; c < lt->cols; c++) {
+        const Column *col = &lt->col[c];
+        cell(t, cx, cy, col->width, col->title, (int)strlen(col->title),
+             false, hdr_fg, hdr_bg);
+        cx += col->width + 2;
+        tui_putc(t, cx++, cy, '|', fg, bg);
+    }
+    cy++;
+    sep(t, x, cy++, lt, fg, bg);
+
+    for (int r = first; r < first + count; r++, cy++) {
+        Cell *row = &lt->cells[(size_t)r * lt->cols];
+        cx = x;
+        tui_putc(t, cx++, cy, '|', fg, bg);
+        for (int c = 0; c < lt->cols; c++) {
+            Cell *k = &row[c];
+            if (k->flags & C_STALE) format(lt, k, c);
+            uint8_t b = k->flash_until > lt->now
+                      ? (k->dir > 0 ? lt->up_bg : lt->down_bg) : bg;
+            cell(t, cx, cy, lt->col[c].width, k->text, k->len,
+                 k->flags & C_SHOWN, fg, b);
+            cx += lt->col[c].width + 2;
+            tui_putc(t, cx++, cy, '|', fg, bg);
+        }
+    }
+    sep(t, x, cy++, lt, fg, bg);
+    return cy - y;
+}
@@ -0,0 +1,58 @@
+#ifndef TUI_LIVE_H
+#define TUI_LIVE_H
+
+#include "tui.h"
+
+/*
+ * Live table: numeric cells updated from feed threads.
+ *
+ * Any thread may post (row, col, value) updates.  They go into a bounded
+ * ring without locks: a producer claims a slot by compare-and-swap on the
+ * tail and marks it filled with a per-slot sequence number, so producers
+ * never wait on each other or on the UI.
+ *
+ * Each frame the UI thread drains the ring once (tui_live_update, also
+ * done by drawing).  A cell keeps only its latest value, and the first
+ * update of a cell in a frame puts it on a dirty list.  Only dirty cells
+ * are compared with what is shown, and a changed one is formatted again
+ * when it is next drawn.  However many updates arrive, a frame formats at
+ * most one string per visible cell.  A cell whose value went up or down
+ * is drawn in that direction's flash colour for a while.
+ *
+ * The table is drawn with the same borders as tui_draw_table, numbers
+ * right-aligned.
+ */
+
+typedef struct TUI_Live TUI_Live;
+
+typedef struct {
+    uint64_t posted;             /* taken from the ring */
+    uint64_t dropped;            /* refused: the ring was full */
+    uint64_t coalesced;          /* overwritten before they were shown */
+    int      dirty;              /* cells looked at in the last update */
+    int      changed;            /* of those, with a new value */
+} TUI_LiveStats;
+
+/* queue: ring slots, rounded up to a power of two */
+TUI_Live *tui_live_new (int rows, int cols, int queue);
+void      tui_live_free(TUI_Live *lt);
+
+/* UI thread: a column's title, width and printf format for its values */
+void tui_live_column(TUI_Live *lt, int col, const char *title, int width,
+                     const char *fmt);
+/* UI thread: fixed text, e.g. row labels; shown until a value arrives */
+void tui_live_text  (TUI_Live *lt, int row, int col, const char *s);
+/* flash changed cells for ms (0: off), bg by the direction of change */
+void tui_live_flash (TUI_Live *lt, int ms, uint8_t up_bg, uint8_t down_bg);
+
+/* any thread; false if the ring is full (the update is dropped) */
+bool tui_live_post  (TUI_Live *lt, int row, int col, double v);
+
+/* UI thread: apply what was posted; returns the cells changed */
+int  tui_live_update(TUI_Live *lt);
+/* rows [first, first + count) under the header; returns rows used */
+int  tui_draw_live  (TUI *t, int x, int y, TUI_Live *lt, int first, int count,
+                     uint8_t fg, uint8_t bg, uint8_t hdr_fg, uint8_t hdr_bg);
+void tui_live_stats (TUI_Live *lt, TUI_LiveStats *out);
+
+#endif /* TUI_LIVE_H */
@@ -0,0 +1,707 @@
+#define _POSIX_C_SOURCE 200809L
+#include "tui_log.h"
+#include <stdlib.h>
+#include <string.h>
+#include "tui_alloc.h"
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <emmintrin.h>
+#define LOG_SSE2 1
+#endif
+
+#define LOG_STRIDE    16               /* lines per index entry           */
+#define LOG_CHUNK     65536            /* index entries per allocation    */
+#define LOG_FIRST     (64 * 1024)      /* first publish: about one screen */
+#define LOG_STEP      (4 << 20)        /* bytes scanned between publishes */
+#define LOG_POLL_MS   250
+#define LOG_WORKERS   8
+#define LOG_SLICE     (1 << 20)        /* search granularity              */
+#define LOG_REFINE    65536            /* old hits checked between polls  */
+#define LOG_QUERY_MAX 128
+#define LOG_TAB       8
+
+typedef struct {
+    TUI_LogView *v;
+    SDL_Thread  *thread;
+    int          gen;
+    uint64_t     a, b, limit;      /* match starts in [a, b), text < limit */
+    uint64_t     pos;              /* [a, pos) searched; read once joined */
+    uint64_t    *hits;             /* sorted; guarded by res_lock */
+    size_t       nhits, cap;
+    uint64_t    *prev;             /* a shorter query's hits, to narrow */
+    size_t       nprev;
+    bool         done;
+} SearchPart;
+
+struct TUI_LogView {
+    int            fd;
+    SDL_RWLock    *map_lock;       /* write: remap, read: any access */
+    const char    *map;
+    size_t         map_len;
+
+    SDL_Mutex     *idx_lock;       /* guards everything up to indexer */
+    SDL_Condition *wake;
+    uint64_t     **cp;             /* start of line k * LOG_STRIDE */
+    size_t         cp_chunks;
+    uint64_t       ncp, lines, last_start, indexed, size;
+    unsigned       resets;         /* times the file was truncated */
+    bool           stop;
+    SDL_Thread    *indexer;
+
+    SDL_Mutex     *res_lock;
+    SDL_AtomicInt  gen;
+    SearchPart     parts[LOG_WORKERS];
+    int            nparts;
+    char           query[LOG_QUERY_MAX];
+    size_t         qlen;
+    unsigned       searched;       /* resets when the query was searched */
+
+    uint64_t       top, max_top;   /* UI thread only */
+    int            left, view_h;
+    bool           follow;
+    const TUI_ColorRules *rules;
+    TUI_ColorCache *colors;
+};
+
+/* ── Mapping ───────────────────────────────────────────── */
+
+/* map with room to grow so appends rarely need a remap */
+static bool remap(TUI_LogView *v, uint64_t size)
+{
+    size_t want = (size_t)size + (size_t)size / 2 + (64u << 20);
+    void *m = mmap(NULL, want, PROT_READ, MAP_SHARED, v->fd, 0);
+    if (m == MAP_FAILED) return false;
+    SDL_LockRWLockForWriting(v->map_lock);
+    if (v->map) munmap((void *)v->map, v->map_len);
+    v->map     = m;
+    v->map_len = want;
+    SDL_UnlockRWLock(v->map_lock);
+    return true;
+}
+
+static uint64_t file_size(TUI_LogView *v)
+{
+    struct stat st;
+    return fstat(v->fd, &st) == 0 ? (uint64_t)st.st_size : 0;
+}
+
+/* limit cut to what the file still holds: the indexer only notices a
+   truncation at its next poll, and touching mapped pages past the end
+   of the file raises SIGBUS */
+static uint64_t readable(TUI_LogView *v, uint64_t limit)
+{
+    uint64_t size = file_size(v);
+    return size < limit ? size : limit;
+}
+
+/* ── Line index ────────────────────────────────────────── */
+
+static uint64_t cp_get(const TUI_LogView *v, uint64_t k)
+{
+    return v->cp[k / LOG_CHUNK][k % LOG_CHUNK];
+}
+
+/* called by the indexer only; entries past ncp are not yet visible */
+static bool cp_put(TUI_LogView *v, uint64_t k, uint64_t off)
+{
+    size_t c = (size_t)(k / LOG_CHUNK);
+    if (c >= v->cp_chunks) {
+        uint64_t *chunk = malloc(LOG_CHUNK * sizeof *chunk);
+        if (!chunk) return false;
+        SDL_LockMutex(v->idx_lock);
+        uint64_t **nt = realloc(v->cp, (c + 1) * sizeof *nt);
+        if (nt) {
+            v->cp = nt;
+            v->cp[c] = chunk;
+            v->cp_chunks = c + 1;
+        }
+        SDL_UnlockMutex(v->idx_lock);
+        if (!nt) {
+            free(chunk);
+            return false;
+        }
+    }
+    v->cp[c][k % LOG_CHUNK] = off;
+    return true;
+}
+
+typedef struct { uint64_t lines, last, ncp; bool ok; } Scan;
+
+static void newline_at(TUI_LogView *v, Scan *s, uint64_t off)
+{
+    s->lines++;
+    s->last = off + 1;
+    if (s->lines % LOG_STRIDE == 0)
+        s->ok = s->ok && cp_put(v, s->ncp++, off + 1);
+}
+
+static void scan(TUI_LogView *v, Scan *s, const char *p, uint64_t base,
+                 size_t n)
+{
+    size_t i = 0;
+#ifdef LOG_SSE2
+    const __m128i nl = _mm_set1_epi8('\n');
+    for (; i + 16 <= n; i += 16) {
+        __m128i  b = _mm_loadu_si128((const __m128i *)(p + i));
+        unsigned m = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(b, nl));
+        if (!m) continue;
+        /* only find exact positions when an index entry falls here */
+        unsigned c = (unsigned)__builtin_popcount(m);
+        if (s->lines % LOG_STRIDE + c < LOG_STRIDE) {
+            s->lines += c;
+            s->last   = base + i + 32 - (uint64_t)__builtin_clz(m);
+            continue;
+        }
+        while (m) {
+            newline_at(v, s, base + i + (uint64_t)__builtin_ctz(m));
+            m &= m - 1;
+        }
+    }
+#endif
+    for (; i < n; i++)
+        if (p[i] == '\n') newline_at(v, s, base + i);
+}
+
+static int indexer_main(void *data)
+{
+    TUI_LogView *v = data;
+    Scan s = {0, 0, 1, true};
+    uint64_t pos = 0;
+
+    for (;;) {
+        uint64_t size = file_size(v);
+        if (size < pos) {                       /* truncated: start over */
+            SDL_LockMutex(v->idx_lock);
+            v->ncp = 1;
+            v->lines = v->last_start = v->indexed = 0;
+            v->resets++;
+            SDL_UnlockMutex(v->idx_lock);
+            s = (Scan){0, 0, 1, true};
+            pos = 0;
+        }
+        if (size > v->map_len && !remap(v, size)) size = v->map_len;
+
+        if (pos < size && s.ok) {
+            uint64_t n = size - pos;
+            uint64_t step = pos ? LOG_STEP : LOG_FIRST;
+            if (n > step) n = step;
+            SDL_LockRWLockForReading(v->map_lock);
+            scan(v, &s, v->map + pos, pos, (size_t)n);
+            SDL_UnlockRWLock(v->map_lock);
+            pos += n;
+
+            SDL_LockMutex(v->idx_lock);
+            v->ncp        = s.ncp;
+            v->lines      = s.lines;
+            v->last_start = s.last;
+            v->indexed    = pos;
+            v->size       = size;
+            bool stop = v->stop;
+            SDL_UnlockMutex(v->idx_lock);
+            if (stop) break;
+            continue;
+        }
+
+        SDL_LockMutex(v->idx_lock);
+        v->size = size;
+        if (!v->stop) SDL_WaitConditionTimeout(v->wake, v->idx_lock,
+                                               LOG_POLL_MS);
+        bool stop = v->stop;
+        SDL_UnlockMutex(v->idx_lock);
+        if (stop) break;
+    }
+    return 0;
+}
+
+/* lines shown, counting an unterminated last line */
+static uint64_t total_lines(const TUI_LogView *v)
+{
+    return v->lines + (v->indexed > v->last_start ? 1 : 0);
+}
+
+/* offset of line k; caller holds map_lock for reading */
+static uint64_t line_offset(TUI_LogView *v, uint64_t k, uint64_t limit)
+{
+    SDL_LockMutex(v->idx_lock);
+    uint64_t off = cp_get(v, k / LOG_STRIDE);
+    SDL_UnlockMutex(v->idx_lock);
+    for (uint64_t i = k % LOG_STRIDE; i > 0 && off < limit; i--) {
+        const char *nl = memchr(v->map + off, '\n', (size_t)(limit - off));
+        off = nl ? (uint64_t)(nl - v->map) + 1 : limit;
+    }
+    return off;
+}
+
+/* line holding offset; caller holds map_lock for reading */
+static uint64_t offset_line(TUI_LogView *v, uint64_t off)
+{
+    SDL_LockMutex(v->idx_lock);
+    uint64_t lo = 0, hi = v->ncp;
+    while (hi - lo > 1) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (cp_get(v, mid) <= off) lo = mid;
+        else hi = mid;
+    }
+    uint64_t p = cp_get(v, lo);
+    SDL_UnlockMutex(v->idx_lock);
+
+    uint64_t line = lo * LOG_STRIDE;
+    const char *q = v->map + p, *end = v->map + off;
+    while (q < end && (q = memchr(q, '\n', (size_t)(end - q)))) {
+        line++;
+        q++;
+    }
+    return line;
+}
+
+/* ── Open / close ──────────────────────────────────────── */
+
+TUI_LogView *tui_log_open(const char *path)
+{
+    TUI_LogView *v = calloc(1, sizeof *v);
+    if (!v) return NULL;
+    v->fd = open(path, O_RDONLY);
+    if (v->fd < 0) {
+        SDL_SetError("open %s: %s", path, strerror(errno));
+        free(v);
+        return NULL;
+    }
+    v->map_lock = SDL_CreateRWLock();
+    v->idx_lock = SDL_CreateMutex();
+    v->res_lock = SDL_CreateMutex();
+    v->wake     = SDL_CreateCondition();
+    v->follow   = true;
+    if (!v->map_lock || !v->idx_lock || !v->res_lock || !v->wake) {
+        tui_log_close(v);
+        return NULL;
+    }
+    if (!remap(v, file_size(v))) {
+        SDL_SetError("mmap %s: %s", path, strerror(errno));
+        tui_log_close(v);
+        return NULL;
+    }
+    if (!cp_put(v, 0, 0)) {
+        tui_log_close(v);
+        return NULL;
+    }
+    v->ncp = 1;
+    v->indexer = SDL_CreateThread(indexer_main, "tui_log_index", v);
+    if (!v->indexer) {
+        tui_log_close(v);
+        return NULL;
+    }
+    return v;
+}
+
+/* stop the workers but keep what they found */
+static void halt_search(TUI_LogView *v)
+{
+    SDL_AddAtomicInt(&v->gen, 1);
+    for (int i = 0; i < v->nparts; i++) {
+        SDL_WaitThread(v->parts[i].thread, NULL);
+        v->parts[i].thread = NULL;
+    }
+}
+
+static void stop_search(TUI_LogView *v)
+{
+    halt_search(v);
+    for (int i = 0; i < LOG_WORKERS; i++) {
+        free(v->parts[i].hits);
+        free(v->parts[i].prev);
+    }
+    memset(v->parts, 0, sizeof v->parts);
+    v->nparts = 0;
+}
+
+void tui_log_close(TUI_LogView *v)
+{
+    if (!v) return;
+    stop_search(v);
+    if (v->indexer) {
+        SDL_LockMutex(v->idx_lock);
+        v->stop = true;
+        SDL_SignalCondition(v->wake);
+        SDL_UnlockMutex(v->idx_lock);
+        SDL_WaitThread(v->indexer, NULL);
+    }
+    for (size_t i = 0; i < v->cp_chunks; i++) free(v->cp[i]);
+    free(v->cp);
+    if (v->map) munmap((void *)v->map, v->map_len);
+    close(v->fd);
+    tui_color_cache_free(v->colors);
+    SDL_DestroyCondition(v->wake);
+    SDL_DestroyMutex(v->res_lock);
+    SDL_DestroyMutex(v->idx_lock);
+    SDL_DestroyRWLock(v->map_lock);
+    free(v);
+}
+
+/* ── Search ────────────────────────────────────────────── */
+
+static const char *find_in(const char *p, const char *end,
+                           const char *q, size_t qlen)
+{
+    while (p + qlen <= end) {
+        p = memchr(p, q[0], (size_t)(end - p) - qlen + 1);
+        if (!p) return NULL;
+        if (memcmp(p, q, qlen) == 0) return p;
+        p++;
+    }
+    return NULL;
+}
+
+/* append n offsets, all past those found before */
+static void add_hits(SearchPart *sp, const uint64_t *found, size_t n)
+{
+    if (!n) return;
+    SDL_LockMutex(sp->v->res_lock);
+    if (sp->nhits + n > sp->cap) {
+        size_t nc = sp->cap ? sp->cap : 256;
+        while (nc < sp->nhits + n) nc *= 2;
+        uint64_t *nh = realloc(sp->hits, nc * sizeof *nh);
+        if (nh) {
+            sp->hits = nh;
+            sp->cap  = nc;
+        }
+    }
+    if (sp->nhits + n <= sp->cap) {
+        memcpy(sp->hits + sp->nhits, found, n * sizeof *found);
+        sp->nhits += n;
+    }
+    SDL_UnlockMutex(sp->v->res_lock);
+}
+
+/* the query grew: its matches in [a, pos) are the shorter query's
+   matches it still fits, so only those are looked at again */
+static bool refine(SearchPart *sp)
+{
+    TUI_LogView *v = sp->v;
+    uint64_t    *h = sp->prev;
+    size_t       i = 0, n = sp->nprev;
+    bool        ok = true;
+
+    while (i < n && h[i] < sp->pos) {
+        if (SDL_GetAtomicInt(&v->gen) != sp->gen
+            || file_size(v) < sp->limit) {
+            sp->pos = h[i];              /* nothing unchecked lies before */
+            ok = false;
+            break;
+        }
+        size_t from = i, w = i;
+        size_t end  = n - i > LOG_REFINE ? i + LOG_REFINE : n;
+        SDL_LockRWLockForReading(v->map_lock);
+        for (; i < end && h[i] < sp->pos; i++)
+            if (h[i] + v->qlen <= sp->limit
+                && memcmp(v->map + h[i], v->query, v->qlen) == 0)
+                h[w++] = h[i];
+        SDL_UnlockRWLock(v->map_lock);
+        add_hits(sp, h + from, w - from);
+    }
+    free(sp->prev);
+    sp->prev  = NULL;
+    sp->nprev = 0;
+    return ok;
+}
+
+static int search_main(void *data)
+{
+    SearchPart  *sp = data;
+    TUI_LogView *v  = sp->v;
+    uint64_t *found = NULL;
+    size_t    cap   = 0;
+
+    if (sp->prev && !refine(sp)) goto out;
+    for (uint64_t pos = sp->pos; pos < sp->b; pos += LOG_SLICE) {
+        uint64_t stop = pos + LOG_SLICE < sp->b ? pos + LOG_SLICE : sp->b;
+        uint64_t tail = stop + v->qlen - 1 < sp->limit ? stop + v->qlen - 1
+                                                        : sp->limit;
+        if (SDL_GetAtomicInt(&v->gen) != sp->gen
+            || file_size(v) < tail) break;
+        size_t n = 0;
+        SDL_LockRWLockForReading(v->map_lock);
+        const char *p = v->map + pos, *end = v->map + tail;
+        while ((p = find_in(p, end, v->query, v->qlen))
+               && p < v->map + stop) {
+            if (n == cap) {
+                size_t nc = cap ? cap * 2 : 256;
+                uint64_t *nf = realloc(found, nc * sizeof *nf);
+                if (!nf) break;
+                found = nf;
+                cap   = nc;
+            }
+            found[n++] = (uint64_t)(p - v->map);
+            p++;
+        }
+        SDL_UnlockRWLock(v->map_lock);
+        add_hits(sp, found, n);
+        sp->pos = stop;
+    }
+out:
+    free(found);
+    SDL_LockMutex(v->res_lock);
+    sp->done = true;
+    SDL_UnlockMutex(v->res_lock);
+    return 0;
+}
+
+/* carry the search on for a query that extends the last one */
+static void narrow_search(TUI_LogView *v, uint64_t end)
+{
+    int gen = SDL_GetAtomicInt(&v->gen);
+    SearchPart *last = &v->parts[v->nparts - 1];
+    uint64_t old = last->limit;
+    for (int i = 0; i < v->nparts; i++) {
+        SearchPart *sp = &v->parts[i];
+        sp->prev  = sp->hits;
+        sp->nprev = sp->nhits;
+        sp->hits  = NULL;
+        sp->nhits = sp->cap = 0;
+        sp->gen   = gen;
+        sp->limit = end;
+        sp->done  = false;
+    }
+    if (end > old) {
+        /* the last part takes what was indexed since; matches that run
+           past the old end were out of reach, so look there again */
+        uint64_t back = old > v->qlen - 1 ? old - (v->qlen - 1) : 0;
+        if (back < last->a) back = last->a;
+        if (last->pos > back) last->pos = back;
+        last->b = end;
+    }
+    for (int i = 0; i < v->nparts; i++) {
+        SearchPart *sp = &v->parts[i];
+        sp->thread = SDL_CreateThread(search_main, "tui_log_search", sp);
+        if (sp->thread) continue;
+        for (int k = i; k < v->nparts; k++) {
+            free(v->parts[k].prev);
+            memset(&v->parts[k], 0, sizeof v->parts[k]);
+        }
+        v->nparts = i;
+        break;
+    }
+}
+
+void tui_log_search(TUI_LogView *v, const char *query)
+{
+    size_t qlen = strlen(query);
+    if (qlen >= LOG_QUERY_MAX) qlen = LOG_QUERY_MAX - 1;
+
+    SDL_LockMutex(v->idx_lock);
+    uint64_t end    = v->indexed;
+    unsigned resets = v->resets;
+    SDL_UnlockMutex(v->idx_lock);
+
+    /* every match of a longer query starts at a match of the old one */
+    bool more = v->nparts && qlen >= v->qlen && resets == v->searched
+             && end >= v->parts[v->nparts - 1].limit
+             && memcmp(query, v->query, v->qlen) == 0;
+    if (more) halt_search(v);
+    else      stop_search(v);
+    memcpy(v->query, query, qlen);
+    v->query[qlen] = '\0';
+    v->qlen     = qlen;
+    v->searched = resets;
+    if (!qlen) return;
+    if (more) {
+        narrow_search(v, end);
+        return;
+    }
+
+    int n = SDL_GetNumLogicalCPUCores();
+    if (n > LOG_WORKERS) n = LOG_WORKERS;
+    if (n < 1 || end < LOG_SLICE) n = 1;
+    int gen = SDL_GetAtomicInt(&v->gen);
+    for (int i = 0; i < n; i++) {
+        SearchPart *sp = &v->parts[i];
+        sp->v     = v;
+        sp->gen   = gen;
+        sp->a     = end * (uint64_t)i / (uint64_t)n;
+        sp->b     = end * (uint64_t)(i + 1) / (uint64_t)n;
+        sp->pos   = sp->a;
+        sp->limit = end;
+        sp->thread = SDL_CreateThread(search_main, "tui_log_search", sp);
+        if (!sp->thread) break;
+        v->nparts = i + 1;
+    }
+}
+
+bool tui_log_find_next(TUI_LogView *v, bool backward)
+{
+    if (!v->qlen) return false;
+    SDL_LockRWLockForReading(v->map_lock);
+    SDL_LockMutex(v->idx_lock);
+    uint64_t total = total_lines(v), limit = v->indexed;
+    SDL_UnlockMutex(v->idx_lock);
+    limit = readable(v, limit);
+
+    bool found = false;
+    uint64_t hit = 0;
+    if (backward || v->top + 1 < total) {
+        uint64_t from = line_offset(v, backward ? v->top : v->top + 1, limit);
+        SDL_LockMutex(v->res_lock);
+        for (int k = 0; k < v->nparts && !found; k++) {
+            SearchPart *sp = &v->parts[backward ? v->nparts - 1 - k : k];
+            size_t lo = 0, hi = sp->nhits;      /* first hit >= from */
+            while (lo < hi) {
+                size_t mid = (lo + hi) / 2;
+                if (sp->hits[mid] < from) lo = mid + 1;
+                else hi = mid;
+            }
+            if (!backward && lo < sp->nhits) found = true, hit = sp->hits[lo];
+            if (backward && lo > 0) found = true, hit = sp->hits[lo - 1];
+        }
+        SDL_UnlockMutex(v->res_lock);
+    }
+    if (found && hit > limit) found = false;   /* the file shrank */
+    if (found) {
+        v->top    = offset_line(v, hit);
+        v->follow = false;
+    }
+    SDL_UnlockRWLock(v->map_lock);
+    return found;
+}
+
+void tui_log_info(TUI_LogView *v, TUI_LogInfo *out)
+{
+    memset(out, 0, sizeof *out);
+    SDL_LockMutex(v->idx_lock);
+    out->size    = v->size;
+    out->indexed = v->indexed;
+    out->lines   = total_lines(v);
+    SDL_UnlockMutex(v->idx_lock);
+    SDL_LockMutex(v->res_lock);
+    for (int i = 0; i < v->nparts; i++) {
+        out->matches += v->parts[i].nhits;
+        if (!v->parts[i].done) out->searching = true;
+    }
+    SDL_UnlockMutex(v->res_lock);
+    out->following = v->follow;
+}
+
+/* ── View ──────────────────────────────────────────────── */
+
+bool tui_log_set_colors(TUI_LogView *v, const TUI_ColorRules *r)
+{
+    if (r && !v->colors && !(v->colors = tui_color_cache_new(256)))
+        return false;
+    v->rules = r;
+    return true;
+}
+
+#define IS_CONT(c) (((c) & 0xc0) == 0x80)
+
+bool tui_log_handle(TUI_LogView *v, const SDL_Event *e)
+{
+    if (e->type != SDL_EVENT_KEY_DOWN) return false;
+    int64_t page = v->view_h > 1 ? v->view_h - 1 : 1, d = 0;
+    switch (e->key.key) {
+    case SDLK_UP:       d = -1;    break;
+    case SDLK_DOWN:     d = 1;     break;
+    case SDLK_PAGEUP:   d = -page; break;
+    case SDLK_PAGEDOWN: d = page;  break;
+    case SDLK_HOME:     v->top = 0; v->follow = false; return true;
+    case SDLK_END:      v->follow = true; return true;
+    case SDLK_LEFT:     v->left = v->left > 8 ? v->left - 8 : 0; return true;
+    case SDLK_RIGHT:    v->left += 8; return true;
+    default:            return false;
+    }
+    if (d < 0) {
+        v->top    = (uint64_t)-d > v->top ? 0 : v->top - (uint64_t)-d;
+        v->follow = false;
+    } else if (!v->follow) {
+        v->top += (uint64_t)d;
+        if (v->top >= v->max_top) v->follow = true;   /* back at the end */
+    }
+    return true;
+}
+
+void tui_draw_log(TUI *t, int x, int y, int w, int h, TUI_LogView *v,
+                  uint8_t fg, uint8_t bg, uint8_t hf, uint8_t hb)
+{
+    if (w < 2 || h < 1) return;
+    v->view_h = h;
+    tui_fill(t, x, y, w, h, ' ', fg, bg);
+
+    SDL_LockRWLockForReading(v->map_lock);
+    SDL_LockMutex(v->idx_lock);
+    uint64_t total = total_lines(v), limit = v->indexed;
+    SDL_UnlockMutex(v->idx_lock);
+    limit = readable(v, limit);
+
+    v->max_top = total > (uint64_t)h ? total - (uint64_t)h : 0;
+    if (v->follow || v->top > v->max_top) v->top = v->max_top;
+
+    uint64_t off = line_offset(v, v->top, limit);
+    for (int r = 0; r < h && v->top + (uint64_t)r < total && off <= limit;
+         r++) {
+        uint64_t    ls  = off;
+        const char *p   = v->map + off;
+        const char *nl  = memchr(p, '\n', (size_t)(limit - off));
+        const char *end = nl ? nl : v->map + limit;
+        off = (uint64_t)(end - v->map) + 1;
+        if (end > p && end[-1] == '\r') end--;
+
+        /* rule colours, computed once per line while it stays cached */
+        int ncol = end - p < TUI_COLOR_LINE_MAX ? (int)(end - p)
+                                                : TUI_COLOR_LINE_MAX;
+        const uint8_t *cols = v->rules
+            ? tui_color_cached(v->colors, v->rules, ls, p, ncol, fg) : NULL;
+
+        const char *hs = v->qlen ? find_in(p, end, v->query, v->qlen) : NULL;
+        int col = 0;
+        for (const char *q = p; q < end && col < v->left + w; q++) {
+            if (hs && q >= hs + v->qlen)
+                hs = find_in(hs + v->qlen, end, v->query, v->qlen);
+            unsigned char c = (unsigned char)*q;
+            if (IS_CONT(c)) continue;
+            bool hl = hs && q >= hs;
+            uint8_t f = cols && q - p < ncol ? cols[q - p] : fg;
+            int  nc = c == '\t' ? (col / LOG_TAB + 1) * LOG_TAB : col + 1;
+            char ch = c == '\t' ? ' '
+                    : (c < 0x20 || c >= 0x7f) ? '?' : (char)c;
+            for (; col < nc; col++)
+                if (col >= v->left && col < v->left + w)
+                    tui_putc(t, x + col - v->left, y + r, ch,
+                             hl ? hf : f, hl ? hb : bg);
+        }
+    }
+    SDL_UnlockRWLock(v->map_lock);
+
+    tui_scroll_marks(t, x + w - 1, y, h, v->top > 0, v->top < v->max_top,
+                     TUI_YELLOW, bg);
+}
+
+#else /* _WIN32 */
+
+TUI_LogView *tui_log_open(const char *path)
+{
+    (void)path;
+    SDL_SetError("log viewer needs mmap");
+    return NULL;
+}
+void tui_log_close(TUI_LogView *v) { (void)v; }
+void tui_draw_log(TUI *t, int x, int y, int w, int h, TUI_LogView *v,
+                  uint8_t fg, uint8_t bg, uint8_t hf, uint8_t hb)
+{
+    (void)t; (void)x; (void)y; (void)w; (void)h; (void)v;
+    (void)fg; (void)bg; (void)hf; (void)hb;
+}
+bool tui_log_handle(TUI_LogView *v, const SDL_Event *e) { (void)v; (void)e; return false; }
+void tui_log_search(TUI_LogView *v, const char *q) { (void)v; (void)q; }
+bool tui_log_find_next(TUI_LogView *v, bool b) { (void)v; (void)b; return false; }
+void tui_log_info(TUI_LogView *v, TUI_LogInfo *out)
+{
+    (void)v;
+    memset(out, 0, sizeof *out);
+}
+bool tui_log_set_colors(TUI_LogView *v, const TUI_ColorRules *r) { (void)v; (void)r; return false; }
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef TUI_LOG_H
+#define TUI_LOG_H
+
+#include "tui.h"
+#include "tui_color.h"
+
+/*
+ * Read-only log viewer.
+ *
+ * The file is mapped, never read into memory.  A worker thread scans it for
+ * newlines (16 bytes at a time with SSE2) and records the start of every
+ * 16th line, publishing the index as it goes, so the first screen is shown
+ * before the file is fully scanned.  Once it reaches the end the worker
+ * keeps polling the file size and indexes appended data, like tail -f;
+ * the view follows the end until the user scrolls up.
+ *
+ * A search splits the part indexed so far between several threads, which
+ * collect match offsets in the background.  When the query grows by
+ * typing, the threads narrow the matches found so far and carry on where
+ * they stopped instead of scanning from the start.  Drawing highlights
+ * matches of the current query in the visible lines only, as is colouring
+ * by rules.
+ *
+ * Nothing past the file's current size is read, so a log truncated under
+ * the viewer is not touched beyond its end (SIGBUS) before the indexer
+ * starts over.
+ */
+
+typedef struct TUI_LogView TUI_LogView;
+
+typedef struct {
+    uint64_t size;          /* bytes in the file                      */
+    uint64_t indexed;       /* bytes scanned for newlines             */
+    uint64_t lines;         /* lines in the indexed part              */
+    uint64_t matches;       /* found so far for the current query     */
+    bool     searching;
+    bool     following;
+} TUI_LogInfo;
+
+TUI_LogView *tui_log_open (const char *path);
+void         tui_log_close(TUI_LogView *v);
+
+void tui_draw_log  (TUI *t, int x, int y, int w, int h, TUI_LogView *v,
+                    uint8_t fg, uint8_t bg, uint8_t hl_fg, uint8_t hl_bg);
+bool tui_log_handle(TUI_LogView *v, const SDL_Event *e);
+
+/* start a background search, or narrow the last one; "" clears it */
+void tui_log_search   (TUI_LogView *v, const char *query);
+/* scroll to the next / previous line with a match found so far */
+bool tui_log_find_next(TUI_LogView *v, bool backward);
+void tui_log_info     (TUI_LogView *v, TUI_LogInfo *out);
+/* colour visible lines by rules (NULL to stop); r must outlive the view */
+bool tui_log_set_colors(TUI_LogView *v, const TUI_ColorRules *r);
+
+#endif /* TUI_LOG_H */
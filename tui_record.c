@@ -0,0 +1,507 @@
+#include "tui_record.h"
+#include "tui_ansi.h"
+#include "tui_remote.h"
+#include <stdlib.h>
+#include <string.h>
+#include "tui_alloc.h"
+
+/* ── Recording format ──────────────────────────────────── */
+/*
+ * header : "TUIR" u8 version u8 blink_on u16 0  varint blink_ms
+ *          varint start_ns
+ * record : u8 tag  varint dt_ns  payload
+ *
+ *   REC_EVENT  varint type, then per-type fields (see put_event)
+ *   REC_FRAME  varint cols, varint rows, varint now_ms, u64 hash
+ *
+ * Integers are LEB128 varints (zigzag for signed), floats are raw
+ * little-endian IEEE-754, dt_ns is relative to the previous record.
+ */
+
+#define REC_MAGIC   "TUIR"
+#define REC_VERSION 1
+#define REC_BUF     (64 * 1024)
+
+enum { REC_EVENT = 1, REC_FRAME = 2 };
+enum { MODE_RECORD = 1, MODE_REPLAY = 2 };
+
+struct TUI_Record {
+    int            mode;
+    uint64_t       last_ns;
+
+    /* record */
+    SDL_IOStream  *io;
+    uint8_t       *buf;
+    size_t         len;
+
+    /* replay */
+    uint8_t       *data;
+    size_t         size, pos;
+    bool           have_frame;
+    int            f_cols, f_rows;
+    uint64_t       f_now, f_hash;
+    uint64_t       frame_ns, start_ns;
+    char          *text;
+    size_t         text_cap;
+    TUI_ReplayReport report;
+};
+
+/* ── Encoding ──────────────────────────────────────────── */
+
+static void rec_flush(TUI_Record *r)
+{
+    if (r->len) SDL_WriteIO(r->io, r->buf, r->len);
+    r->len = 0;
+}
+
+static void rec_put(TUI_Record *r, const void *p, size_t n)
+{
+    if (r->len + n > REC_BUF) rec_flush(r);
+    if (n > REC_BUF) { SDL_WriteIO(r->io, p, n); return; }
+    memcpy(r->buf + r->len, p, n);
+    r->len += n;
+}
+
+static void put_u8(TUI_Record *r, uint8_t v) { rec_put(r, &v, 1); }
+
+static void put_var(TUI_Record *r, uint64_t v)
+{
+    uint8_t b[10];
+    int n = 0;
+    do {
+        b[n] = (uint8_t)(v & 0x7f);
+        v >>= 7;
+        if (v) b[n] |= 0x80;
+        n++;
+    } while (v);
+    rec_put(r, b, (size_t)n);
+}
+
+static void put_svar(TUI_Record *r, int64_t v)
+{
+    put_var(r, ((uint64_t)v << 1) ^ (uint64_t)(v >> 63));
+}
+
+static void put_u64(TUI_Record *r, uint64_t v)
+{
+    uint8_t b[8];
+    for (int i = 0; i < 8; i++) b[i] = (uint8_t)(v >> (8 * i));
+    rec_put(r, b, 8);
+}
+
+static void put_f32(TUI_Record *r, float f)
+{
+    uint32_t v;
+    memcpy(&v, &f, 4);
+    uint8_t b[4] = {(uint8_t)v, (uint8_t)(v >> 8),
+                    (uint8_t)(v >> 16), (uint8_t)(v >> 24)};
+    rec_put(r, b, 4);
+}
+
+static void put_head(TUI_Record *r, uint8_t tag, uint64_t ns)
+{
+    put_u8(r, tag);
+    put_var(r, ns >= r->last_ns ? ns - r->last_ns : 0);
+    r->last_ns = ns;
+}
+
+/* returns false for event types that are not worth replaying */
+static bool put_event(TUI_Record *r, const SDL_Event *e)
+{
+    switch (e->type) {
+    case SDL_EVENT_QUIT:
+    case SDL_EVENT_KEY_DOWN:
+    case SDL_EVENT_KEY_UP:
+    case SDL_EVENT_TEXT_INPUT:
+    case SDL_EVENT_WINDOW_RESIZED:
+    case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
+    case SDL_EVENT_MOUSE_MOTION:
+    case SDL_EVENT_MOUSE_BUTTON_DOWN:
+    case SDL_EVENT_MOUSE_BUTTON_UP:
+    case SDL_EVENT_MOUSE_WHEEL:
+        break;
+    default:
+        return false;
+    }
+
+    put_head(r, REC_EVENT, e->common.timestamp);
+    put_var(r, e->type);
+
+    switch (e->type) {
+    case SDL_EVENT_KEY_DOWN:
+    case SDL_EVENT_KEY_UP:
+        put_var(r, e->key.key);
+        put_var(r, e->key.mod);
+        put_var(r, (uint64_t)e->key.scancode);
+        put_u8 (r, (uint8_t)((e->key.down ? 1 : 0) | (e->key.repeat ? 2 : 0)));
+        break;
+    case SDL_EVENT_TEXT_INPUT: {
+        size_t n = e->text.text ? strlen(e->text.text) : 0;
+        put_var(r, n);
+        rec_put(r, e->text.text, n);
+        break;
+    }
+    case SDL_EVENT_WINDOW_RESIZED:
+    case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
+        put_svar(r, e->window.data1);
+        put_svar(r, e->window.data2);
+        break;
+    case SDL_EVENT_MOUSE_MOTION:
+        put_var(r, e->motion.state);
+        put_f32(r, e->motion.x);
+        put_f32(r, e->motion.y);
+        put_f32(r, e->motion.xrel);
+        put_f32(r, e->motion.yrel);
+        break;
+    case SDL_EVENT_MOUSE_BUTTON_DOWN:
+    case SDL_EVENT_MOUSE_BUTTON_UP:
+        put_u8 (r, e->button.button);
+        put_u8 (r, e->button.clicks);
+        put_f32(r, e->button.x);
+        put_f32(r, e->button.y);
+        break;
+    case SDL_EVENT_MOUSE_WHEEL:
+        put_f32(r, e->wheel.x);
+        put_f32(r, e->wheel.y);
+        put_f32(r, e->wheel.mouse_x);
+        put_f32(r, e->wheel.mouse_y);
+        break;
+    default: break;
+    }
+    return true;
+}
+
+/* ── Decoding ──────────────────────────────────────────── */
+
+static bool get_u8(TUI_Record *r, uint8_t *v)
+{
+    if (r->pos >= r->size) return false;
+    *v = r->data[r->pos++];
+    return true;
+}
+
+static bool get_var(TUI_Record *r, uint64_t *v)
+{
+    uint64_t out = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t b;
+        if (!get_u8(r, &b)) return false;
+        out |= (uint64_t)(b & 0x7f) << shift;
+        if (!(b & 0x80)) { *v = out; return true; }
+    }
+    return false;
+}
+
+static bool get_svar(TUI_Record *r, int32_t *v)
+{
+    uint64_t u;
+    if (!get_var(r, &u)) return false;
+    *v = (int32_t)((int64_t)(u >> 1) ^ -(int64_t)(u & 1));
+    return true;
+}
+
+static bool get_u64(TUI_Record *r, uint64_t *v)
+{
+    if (r->size - r->pos < 8) return false;
+    uint64_t out = 0;
+    for (int i = 0; i < 8; i++)
+        out |= (uint64_t)r->data[r->pos + i] << (8 * i);
+    r->pos += 8;
+    *v = out;
+    return true;
+}
+
+static bool get_f32(TUI_Record *r, float *f)
+{
+    if (r->size - r->pos < 4) return false;
+    const uint8_t *b = r->data + r->pos;
+    uint32_t v = (uint32_t)b[0] | (uint32_t)b[1] << 8
+               | (uint32_t)b[2] << 16 | (uint32_t)b[3] << 24;
+    memcpy(f, &v, 4);
+    r->pos += 4;
+    return true;
+}
+
+static bool get_event(TUI_Record *r, SDL_Event *e)
+{
+    uint64_t type, v;
+    memset(e, 0, sizeof *e);
+    if (!get_var(r, &type)) return false;
+    e->type = (uint32_t)type;
+    e->common.timestamp = r->last_ns;
+
+    switch (e->type) {
+    case SDL_EVENT_QUIT:
+        return true;
+    case SDL_EVENT_KEY_DOWN:
+    case SDL_EVENT_KEY_UP: {
+        uint8_t fl;
+        if (!get_var(r, &v)) return false;
+        e->key.key = (SDL_Keycode)v;
+        if (!get_var(r, &v)) return false;
+        e->key.mod = (SDL_Keymod)v;
+        if (!get_var(r, &v)) return false;
+        e->key.scancode = (SDL_Scancode)v;
+        if (!get_u8(r, &fl)) return false;
+        e->key.down   = fl & 1;
+        e->key.repeat = (fl & 2) != 0;
+        return true;
+    }
+    case SDL_EVENT_TEXT_INPUT:
+        if (!get_var(r, &v) || v > r->size - r->pos) return false;
+        if (v + 1 > r->text_cap) {
+            char *nt = realloc(r->text, (size_t)v + 1);
+            if (!nt) return false;
+            r->text     = nt;
+            r->text_cap = (size_t)v + 1;
+        }
+        memcpy(r->text, r->data + r->pos, (size_t)v);
+        r->text[v] = '\0';
+        r->pos += (size_t)v;
+        e->text.text = r->text;
+        return true;
+    case SDL_EVENT_WINDOW_RESIZED:
+    case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
+        return get_svar(r, &e->window.data1)
+            && get_svar(r, &e->window.data2);
+    case SDL_EVENT_MOUSE_MOTION:
+        if (!get_var(r, &v)) return false;
+        e->motion.state = (SDL_MouseButtonFlags)v;
+        return get_f32(r, &e->motion.x)    && get_f32(r, &e->motion.y)
+            && get_f32(r, &e->motion.xrel) && get_f32(r, &e->motion.yrel);
+    case SDL_EVENT_MOUSE_BUTTON_DOWN:
+    case SDL_EVENT_MOUSE_BUTTON_UP:
+        e->button.down = e->type == SDL_EVENT_MOUSE_BUTTON_DOWN;
+        return get_u8(r, &e->button.button) && get_u8(r, &e->button.clicks)
+            && get_f32(r, &e->button.x)     && get_f32(r, &e->button.y);
+    case SDL_EVENT_MOUSE_WHEEL:
+        return get_f32(r, &e->wheel.x)       && get_f32(r, &e->wheel.y)
+            && get_f32(r, &e->wheel.mouse_x) && get_f32(r, &e->wheel.mouse_y);
+    default:
+        return false;
+    }
+}
+
+/* ── Start / stop ──────────────────────────────────────── */
+
+static TUI_Record *rec_new(TUI *t, int mode)
+{
+    tui_record_stop(t);
+    TUI_Record *r = calloc(1, sizeof *r);
+    if (r) r->mode = mode;
+    return r;
+}
+
+bool tui_record_start(TUI *t, const char *path)
+{
+    TUI_Record *r = rec_new(t, MODE_RECORD);
+    if (!r) return false;
+    r->buf = malloc(REC_BUF);
+    r->io  = SDL_IOFromFile(path, "wb");
+    if (!r->buf || !r->io) {
+        if (r->io) SDL_CloseIO(r->io);
+        free(r->buf);
+        free(r);
+        return false;
+    }
+    rec_put(r, REC_MAGIC, 4);
+    put_u8(r, REC_VERSION);
+    put_u8(r, t->blink_on ? 1 : 0);
+    put_u8(r, 0);
+    put_u8(r, 0);
+    put_var(r, t->blink_ms);
+    r->last_ns = SDL_GetTicksNS();
+    put_var(r, r->last_ns);
+    t->rec = r;
+    return true;
+}
+
+bool tui_replay_start(TUI *t, const char *path)
+{
+    TUI_Record *r = rec_new(t, MODE_REPLAY);
+    if (!r) return false;
+    r->data = SDL_LoadFile(path, &r->size);
+    if (!r->data || r->size < 8 || memcmp(r->data, REC_MAGIC, 4) != 0
+        || r->data[4] != REC_VERSION) {
+        SDL_free(r->data);
+        free(r);
+        return SDL_SetError("%s: not a TUI recording", path);
+    }
+    t->blink_on = r->data[5] != 0;
+    r->pos = 8;
+    if (!get_var(r, &t->blink_ms) || !get_var(r, &r->last_ns)) {
+        SDL_free(r->data);
+        free(r);
+        return SDL_SetError("%s: truncated header", path);
+    }
+    r->report.first_mismatch = -1;
+    r->report.build_ns_min   = UINT64_MAX;
+    r->start_ns = SDL_GetTicksNS();
+    t->rec = r;
+    return true;
+}
+
+void tui_record_stop(TUI *t)
+{
+    TUI_Record *r = t->rec;
+    if (!r) return;
+    if (r->io) {
+        rec_flush(r);
+        SDL_CloseIO(r->io);
+    }
+    free(r->buf);
+    SDL_free(r->data);
+    free(r->text);
+    free(r);
+    t->rec = NULL;
+}
+
+void tui_replay_report(const TUI *t, TUI_ReplayReport *out)
+{
+    memset(out, 0, sizeof *out);
+    out->first_mismatch = -1;
+    if (!t->rec || t->rec->mode != MODE_REPLAY) return;
+    *out = t->rec->report;
+    if (out->frames == 0) out->build_ns_min = 0;
+}
+
+/* ── Event source ──────────────────────────────────────── */
+
+static bool replay_poll(TUI *t, TUI_Record *r, SDL_Event *e)
+{
+    if (r->have_frame) return false;     /* frame still pending */
+
+    while (r->pos < r->size) {
+        uint8_t  tag;
+        uint64_t dt, v;
+        if (!get_u8(r, &tag) || !get_var(r, &dt)) break;
+        r->last_ns += dt;
+
+        if (tag == REC_EVENT) {
+            if (!get_event(r, e)) break;
+            r->report.events++;
+            return true;
+        }
+        if (tag == REC_FRAME) {
+            if (!get_var(r, &v)) break;
+            r->f_cols = (int)v;
+            if (!get_var(r, &v)) break;
+            r->f_rows = (int)v;
+            if (!get_var(r, &r->f_now) || !get_u64(r, &r->f_hash)) break;
+            r->have_frame = true;
+            return false;
+        }
+        break;
+    }
+    /* end of recording (or corrupt tail) ends the session */
+    r->pos = r->size;
+    t->running = false;
+    return false;
+}
+
+/* Mouse positions are stored in cells, not pixels: replay runs headless,
+   where a cell is one unit square, and tui_mouse_handle then resolves
+   them to the same cells as the live session did. */
+static void mouse_in_cells(const TUI *t, SDL_Event *e)
+{
+    float cw = (float)(t->cell_w * t->scale);
+    float ch = (float)(t->cell_h * t->scale);
+    switch (e->type) {
+    case SDL_EVENT_MOUSE_MOTION:
+        e->motion.x    = SDL_floorf(e->motion.x / cw);
+        e->motion.y    = SDL_floorf(e->motion.y / ch);
+        e->motion.xrel /= cw;
+        e->motion.yrel /= ch;
+        break;
+    case SDL_EVENT_MOUSE_BUTTON_DOWN:
+    case SDL_EVENT_MOUSE_BUTTON_UP:
+        e->button.x = SDL_floorf(e->button.x / cw);
+        e->button.y = SDL_floorf(e->button.y / ch);
+        break;
+    case SDL_EVENT_MOUSE_WHEEL:
+        e->wheel.mouse_x = SDL_floorf(e->wheel.mouse_x / cw);
+        e->wheel.mouse_y = SDL_floorf(e->wheel.mouse_y / ch);
+        break;
+    default: break;
+    }
+}
+
+bool tui_replaying(const TUI *t)
+{
+    return t->rec && t->rec->mode == MODE_REPLAY;
+}
+
+bool tui_replay_poll(TUI *t, SDL_Event *e)
+{
+    return replay_poll(t, t->rec, e);
+}
+
+void tui_record_event(TUI *t, const SDL_Event *e)
+{
+    if (!t->rec || t->rec->mode != MODE_RECORD) return;
+    SDL_Event c = *e;
+    mouse_in_cells(t, &c);
+    put_event(t->rec, &c);
+}
+
+/* ── Frame hooks ───────────────────────────────────────── */
+
+uint64_t tui_cells_hash(const TUI *t)
+{
+    /* FNV-1a over dimensions and raw cells */
+    uint64_t h = 0xcbf29ce484222325ull;
+    const uint8_t *p = (const uint8_t *)t->cells;
+    size_t n = (size_t)t->cols * (size_t)t->rows * sizeof(TUI_Cell);
+    h = (h ^ (uint64_t)t->cols) * 0x100000001b3ull;
+    h = (h ^ (uint64_t)t->rows) * 0x100000001b3ull;
+    for (size_t i = 0; i < n; i++)
+        h = (h ^ p[i]) * 0x100000001b3ull;
+    return h;
+}
+
+bool tui_record_frame_begin(TUI *t, int *cols, int *rows, uint64_t *now_ms)
+{
+    TUI_Record *r = t->rec;
+    if (r->mode == MODE_RECORD) {
+        r->f_now = *now_ms;
+        return false;
+    }
+    r->frame_ns = SDL_GetTicksNS();
+    if (!r->have_frame) return false;
+    *cols   = r->f_cols;
+    *rows   = r->f_rows;
+    *now_ms = r->f_now;
+    return true;
+}
+
+bool tui_record_frame_end(TUI *t)
+{
+    TUI_Record *r = t->rec;
+
+    if (r->mode == MODE_RECORD) {
+        put_head(r, REC_FRAME, SDL_GetTicksNS());
+        put_var(r, (uint64_t)t->cols);
+        put_var(r, (uint64_t)t->rows);
+        put_var(r, r->f_now);
+        put_u64(r, tui_cells_hash(t));
+        return false;
+    }
+
+    /* replay: never render, only verify */
+    if (!r->have_frame) return true;
+    r->have_frame = false;
+
+    uint64_t now = SDL_GetTicksNS();
+    uint64_t ns  = now - r->frame_ns;
+    TUI_ReplayReport *rp = &r->report;
+    rp->build_ns_total += ns;
+    if (ns < rp->build_ns_min) rp->build_ns_min = ns;
+    if (ns > rp->build_ns_max) rp->build_ns_max = ns;
+    if (tui_cells_hash(t) != r->f_hash) {
+        if (rp->first_mismatch < 0) rp->first_mismatch = (int64_t)rp->frames;
+        rp->mismatches++;
+    }
+    rp->frames++;
+    rp->wall_ns = now - r->start_ns;
+    return true;
+}
@@ -0,0 +1,45 @@
+#ifndef TUI_RECORD_H
+#define TUI_RECORD_H
+
+#include "tui.h"
+
+/*
+ * Session recording and headless replay.
+ *
+ * While recording, every event returned by tui_poll_event() and the hash
+ * of the finished cell grid at every tui_end() are appended to a compact
+ * binary file.  Replaying feeds those events back through tui_poll_event()
+ * one frame at a time, as fast as possible, and checks that each frame
+ * built by the application hashes to the recorded value.  Rendering is
+ * skipped during replay, so it works with a context from
+ * tui_init_headless().
+ */
+
+typedef struct {
+    uint64_t frames;
+    uint64_t events;
+    uint64_t mismatches;
+    int64_t  first_mismatch;      /* frame index, -1 if all matched */
+    uint64_t build_ns_total;      /* tui_begin .. tui_end, summed */
+    uint64_t build_ns_min;
+    uint64_t build_ns_max;
+    uint64_t wall_ns;             /* replay start .. last frame */
+} TUI_ReplayReport;
+
+bool     tui_record_start (TUI *t, const char *path);
+bool     tui_replay_start (TUI *t, const char *path);
+void     tui_record_stop  (TUI *t);
+void     tui_replay_report(const TUI *t, TUI_ReplayReport *r);
+
+uint64_t tui_cells_hash   (const TUI *t);
+
+/* hooks used by tui_begin / tui_end */
+bool tui_record_frame_begin(TUI *t, int *cols, int *rows, uint64_t *now_ms);
+bool tui_record_frame_end  (TUI *t);
+/* hooks used by tui_poll_event: the replay as event source, and events
+   as they are handed to the application */
+bool tui_replaying   (const TUI *t);
+bool tui_replay_poll (TUI *t, SDL_Event *e);
+void tui_record_event(TUI *t, const SDL_Event *e);
+
+#endif /* TUI_RECORD_H */
@@ -0,0 +1,850 @@
+#define _POSIX_C_SOURCE 200809L
+#include "tui_remote.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "tui_alloc.h"
+
+/* ── Frame codec ───────────────────────────────────────── */
+/*
+ * A frame is a list of spans:  varint skip, varint count, cell tokens.
+ * skip counts unchanged cells since the end of the previous span, in
+ * row-major order.  Cell tokens:
+ *
+ *   0x00..0x7f  literal   (t + 1) chars in the current colour
+ *   0x80..0xbf  repeat    next char (t & 0x3f) + 2 times
+ *   0xc0        colour    next byte = fg | bg << 4
+ *
+ * The colour state carries over from span to span within a frame.
+ */
+
+#define TOK_REPEAT 0x80
+#define TOK_ATTR   0xc0
+#define GAP_MERGE  3      /* unchanged gaps this short join the span */
+
+static uint8_t cell_attr(TUI_Cell c)
+{
+    return (uint8_t)((c.fg % TUI_PALETTE_SIZE)
+                     | (c.bg % TUI_PALETTE_SIZE) << 4);
+}
+
+static bool cell_same(TUI_Cell a, TUI_Cell b)
+{
+    return a.ch == b.ch && cell_attr(a) == cell_attr(b);
+}
+
+static size_t put_var(uint8_t *out, uint64_t v)
+{
+    size_t n = 0;
+    do {
+        out[n] = (uint8_t)(v & 0x7f);
+        v >>= 7;
+        if (v) out[n] |= 0x80;
+        n++;
+    } while (v);
+    return n;
+}
+
+static bool get_var(const uint8_t **p, const uint8_t *end, uint64_t *v)
+{
+    uint64_t out = 0;
+    for (int shift = 0; shift < 64 && *p < end; shift += 7) {
+        uint8_t b = *(*p)++;
+        out |= (uint64_t)(b & 0x7f) << shift;
+        if (!(b & 0x80)) { *v = out; return true; }
+    }
+    return false;
+}
+
+size_t tui_delta_encode(const TUI_Cell *prev, const TUI_Cell *cur, int n,
+                        uint8_t *out)
+{
+    size_t o = 0;
+    int last = 0, attr = -1;
+    int i = 0;
+
+    while (i < n) {
+        if (prev && cell_same(prev[i], cur[i])) { i++; continue; }
+
+        /* extend the span across short unchanged gaps */
+        int end = i + 1;
+        for (;;) {
+            int j = end;
+            while (j < n && prev && cell_same(prev[j], cur[j])
+                   && j - end < GAP_MERGE)
+                j++;
+            if (j >= n || (prev && cell_same(prev[j], cur[j]))) break;
+            end = j + 1;
+        }
+
+        o += put_var(out + o, (uint64_t)(i - last));
+        o += put_var(out + o, (uint64_t)(end - i));
+
+        int k = i;
+        while (k < end) {
+            int a = cell_attr(cur[k]);
+            if (a != attr) {
+                out[o++] = TOK_ATTR;
+                out[o++] = (uint8_t)a;
+                attr = a;
+            }
+            int r = 1;
+            while (k + r < end && r < 65 && cell_same(cur[k + r], cur[k]))
+                r++;
+            if (r >= 3) {
+                out[o++] = (uint8_t)(TOK_REPEAT | (r - 2));
+                out[o++] = (uint8_t)cur[k].ch;
+                k += r;
+                continue;
+            }
+            int l = 0;
+            while (k + l < end && l < 128 && cell_attr(cur[k + l]) == attr) {
+                if (k + l + 2 < end && cell_same(cur[k + l], cur[k + l + 1])
+                    && cell_same(cur[k + l], cur[k + l + 2]) && l > 0)
+                    break;
+                l++;
+            }
+            out[o++] = (uint8_t)(l - 1);
+            for (int m = 0; m < l; m++) out[o++] = (uint8_t)cur[k + m].ch;
+            k += l;
+        }
+        last = i = end;
+    }
+    return o;
+}
+
+bool tui_delta_decode(TUI_Cell *cells, int n, const uint8_t *in, size_t len)
+{
+    const uint8_t *p = in, *end = in + len;
+    uint8_t attr = 0x07;
+    uint64_t idx = 0;
+
+    while (p < end) {
+        uint64_t skip, count;
+        if (!get_var(&p, end, &skip) || !get_var(&p, end, &count))
+            return false;
+        idx += skip;
+        if (idx + count > (uint64_t)n) return false;
+        uint64_t stop = idx + count;
+
+        while (idx < stop) {
+            if (p >= end) return false;
+            uint8_t tk = *p++;
+            if (tk == TOK_ATTR) {
+                if (p >= end) return false;
+                attr = *p++;
+                continue;
+            }
+            TUI_Cell c = {0, (uint8_t)(attr & 15), (uint8_t)(attr >> 4)};
+            if (tk & TOK_REPEAT) {
+                if (tk > (TOK_REPEAT | 0x3f) || p >= end) return false;
+                int r = (tk & 0x3f) + 2;
+                if (idx + (uint64_t)r > stop) return false;
+                c.ch = (char)*p++;
+                for (int m = 0; m < r; m++) cells[idx++] = c;
+            } else {
+                int l = tk + 1;
+                if (idx + (uint64_t)l > stop || end - p < l) return false;
+                for (int m = 0; m < l; m++) {
+                    c.ch = (char)*p++;
+                    cells[idx++] = c;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/* ── LZ compression ────────────────────────────────────── */
+/*
+ * LZ4-style block format: token (literal length << 4 | match length - 4),
+ * extra length bytes for nibbles of 15, literals, u16 match offset.  The
+ * final sequence carries literals only.
+ */
+
+#define LZ_HASH_BITS 12
+#define LZ_MIN_MATCH 4
+#define LZ_TAIL      5
+
+static uint32_t read32(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static size_t lz_len(uint8_t *out, size_t v)
+{
+    size_t o = 0;
+    while (v >= 255) { out[o++] = 255; v -= 255; }
+    out[o++] = (uint8_t)v;
+    return o;
+}
+
+size_t tui_lz_compress(const uint8_t *in, size_t n, uint8_t *out)
+{
+    uint32_t table[1 << LZ_HASH_BITS];
+    memset(table, 0, sizeof table);
+    size_t o = 0, anchor = 0, i = 0;
+
+    while (n > LZ_TAIL + LZ_MIN_MATCH && i + LZ_MIN_MATCH <= n - LZ_TAIL) {
+        uint32_t seq = read32(in + i);
+        uint32_t h   = (seq * 2654435761u) >> (32 - LZ_HASH_BITS);
+        size_t   ref = table[h];
+        table[h] = (uint32_t)i + 1;
+        if (!ref || i + 1 - ref > 65535 || read32(in + ref - 1) != seq) {
+            i++;
+            continue;
+        }
+        ref--;
+
+        size_t ml = LZ_MIN_MATCH;
+        while (i + ml < n - LZ_TAIL && in[ref + ml] == in[i + ml]) ml++;
+
+        size_t lit = i - anchor, mc = ml - LZ_MIN_MATCH;
+        out[o++] = (uint8_t)((lit < 15 ? lit : 15) << 4 | (mc < 15 ? mc : 15));
+        if (lit >= 15) o += lz_len(out + o, lit - 15);
+        memcpy(out + o, in + anchor, lit);
+        o += lit;
+        out[o++] = (uint8_t)(i - ref);
+        out[o++] = (uint8_t)((i - ref) >> 8);
+        if (mc >= 15) o += lz_len(out + o, mc - 15);
+
+        i += ml;
+        anchor = i;
+    }
+
+    size_t lit = n - anchor;
+    out[o++] = (uint8_t)((lit < 15 ? lit : 15) << 4);
+    if (lit >= 15) o += lz_len(out + o, lit - 15);
+    memcpy(out + o, in + anchor, lit);
+    return o + lit;
+}
+
+size_t tui_lz_decompress(const uint8_t *in, size_t n,
+                         uint8_t *out, size_t cap)
+{
+    const uint8_t *p = in, *end = in + n;
+    size_t o = 0;
+
+    while (p < end) {
+        uint8_t tk = *p++;
+        size_t lit = tk >> 4;
+        if (lit == 15) {
+            uint8_t b;
+            do {
+                if (p >= end) return 0;
+                b = *p++;
+                lit += b;
+            } while (b == 255);
+        }
+        if ((size_t)(end - p) < lit || cap - o < lit) return 0;
+        memcpy(out + o, p, lit);
+        p += lit;
+        o += lit;
+        if (p == end) break;
+
+        if (end - p < 2) return 0;
+        size_t off = (size_t)p[0] | (size_t)p[1] << 8;
+        p += 2;
+        size_t ml = tk & 15;
+        if (ml == 15) {
+            uint8_t b;
+            do {
+                if (p >= end) return 0;
+                b = *p++;
+                ml += b;
+            } while (b == 255);
+        }
+        ml += LZ_MIN_MATCH;
+        if (off == 0 || off > o || cap - o < ml) return 0;
+        for (size_t m = 0; m < ml; m++, o++) out[o] = out[o - off];
+    }
+    return o;
+}
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/* ── Connection ────────────────────────────────────────── */
+/*
+ * Messages: u32 length (type + body), u8 type, body.
+ *
+ *   MSG_SIZE   c->s  varint cols, varint rows
+ *   MSG_EVENT  c->s  varint type, then key / text fields
+ *   MSG_ACK    c->s  varint seq, varint stamp_us
+ *   MSG_FRAME  s->c  u8 flags, varint seq, varint stamp_us,
+ *                    varint cols, varint rows, [varint raw_len], body
+ */
+
+#ifdef MSG_NOSIGNAL
+#define SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SEND_FLAGS 0
+#endif
+
+#define FRAME_MS 16
+#define MAX_DIM  4096     /* a frame larger than this is refused */
+
+enum { MSG_SIZE = 1, MSG_EVENT, MSG_ACK, MSG_FRAME };
+enum { FR_KEY = 1, FR_LZ = 2 };
+
+struct TUI_Remote {
+    int        fd;
+    bool       closed, quit_sent;
+
+    TUI_Cell  *prev;              /* server: last sent, client: mirror */
+    int        cols, rows;
+    int        want_cols, want_rows;
+    bool       key;
+
+    uint8_t   *enc, *lz;
+    size_t     enc_cap;
+    uint8_t   *tx;
+    size_t     tx_cap;
+    uint8_t   *rx;
+    size_t     rx_len, rx_off, rx_cap;
+    uint8_t   *out;               /* sent in part: the peer is behind */
+    size_t     out_len, out_off, out_cap;
+
+    uint64_t   seq, next_frame_ms;
+    uint8_t   *text;              /* the last text event, NUL-terminated */
+    size_t     text_cap;
+    TUI_RemoteStats stats;
+};
+
+static uint64_t now_us(void) { return SDL_GetTicksNS() / 1000; }
+
+static bool grow(uint8_t **buf, size_t *cap, size_t need)
+{
+    if (need <= *cap) return true;
+    size_t nc = *cap ? *cap : 4096;
+    while (nc < need) nc *= 2;
+    uint8_t *nb = realloc(*buf, nc);
+    if (!nb) return false;
+    *buf = nb;
+    *cap = nc;
+    return true;
+}
+
+/* write what the socket takes now; false while some is left over */
+static bool send_some(TUI_Remote *r, const uint8_t **p, size_t *n)
+{
+    while (*n && !r->closed) {
+        ssize_t w = send(r->fd, *p, *n, SEND_FLAGS);
+        if (w > 0) {
+            *p += w;
+            *n -= (size_t)w;
+            r->stats.bytes_sent += (uint64_t)w;
+            continue;
+        }
+        if (w < 0 && errno == EINTR) continue;
+        if (w < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return false;
+        r->closed = true;
+    }
+    return true;
+}
+
+/* send what is queued; true once nothing is */
+static bool flush(TUI_Remote *r)
+{
+    const uint8_t *p = r->out + r->out_off;
+    size_t n = r->out_len - r->out_off;
+    bool done = send_some(r, &p, &n);
+    r->out_off = r->out_len - n;
+    if (done || r->closed) r->out_off = r->out_len = 0;
+    return done || r->closed;
+}
+
+/* never waits for the peer: what the socket does not take is queued */
+static void send_all(TUI_Remote *r, const uint8_t *p, size_t n)
+{
+    if (!flush(r) || !send_some(r, &p, &n)) {
+        if (r->out_off > r->out_cap / 2) {
+            memmove(r->out, r->out + r->out_off, r->out_len - r->out_off);
+            r->out_len -= r->out_off;
+            r->out_off  = 0;
+        }
+        if (!grow(&r->out, &r->out_cap, r->out_len + n)) {
+            r->closed = true;           /* the stream would be corrupt */
+            return;
+        }
+        memcpy(r->out + r->out_len, p, n);
+        r->out_len += n;
+    }
+}
+
+/* body is written by the caller at tx + 5 */
+static void send_msg(TUI_Remote *r, uint8_t type, size_t body)
+{
+    uint32_t len = (uint32_t)(body + 1);
+    r->tx[0] = (uint8_t)len;
+    r->tx[1] = (uint8_t)(len >> 8);
+    r->tx[2] = (uint8_t)(len >> 16);
+    r->tx[3] = (uint8_t)(len >> 24);
+    r->tx[4] = type;
+    send_all(r, r->tx, body + 5);
+}
+
+/* pull whatever is readable without blocking; false once the peer is gone */
+static bool recv_some(TUI_Remote *r)
+{
+    if (r->rx_off && r->rx_off == r->rx_len) r->rx_off = r->rx_len = 0;
+    if (r->rx_off > r->rx_cap / 2) {
+        memmove(r->rx, r->rx + r->rx_off, r->rx_len - r->rx_off);
+        r->rx_len -= r->rx_off;
+        r->rx_off  = 0;
+    }
+    for (;;) {
+        if (!grow(&r->rx, &r->rx_cap, r->rx_len + 16384)) return false;
+        ssize_t n = recv(r->fd, r->rx + r->rx_len, r->rx_cap - r->rx_len, 0);
+        if (n > 0) { r->rx_len += (size_t)n; continue; }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true;
+        r->closed = true;
+        return false;
+    }
+}
+
+static bool next_msg(TUI_Remote *r, uint8_t *type,
+                     const uint8_t **body, size_t *len)
+{
+    size_t avail = r->rx_len - r->rx_off;
+    if (avail < 5) return false;
+    const uint8_t *h = r->rx + r->rx_off;
+    uint32_t n = (uint32_t)h[0] | (uint32_t)h[1] << 8
+               | (uint32_t)h[2] << 16 | (uint32_t)h[3] << 24;
+    if (n == 0) { r->closed = true; return false; }
+    if (avail < 4 + (size_t)n) return false;
+    *type = h[4];
+    *body = h + 5;
+    *len  = n - 1;
+    r->rx_off += 4 + (size_t)n;
+    return true;
+}
+
+static void sock_opts(int fd)
+{
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof one);
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+}
+
+static TUI_Remote *remote_new(int fd)
+{
+    TUI_Remote *r = calloc(1, sizeof *r);
+    if (!r) return NULL;
+    r->fd  = fd;
+    r->key = true;
+    r->stats.rtt_us_min = UINT64_MAX;
+    sock_opts(fd);
+    return r;
+}
+
+void tui_remote_free(TUI_Remote *r)
+{
+    if (!r) return;
+    close(r->fd);
+    free(r->prev);
+    free(r->enc);
+    free(r->lz);
+    free(r->tx);
+    free(r->rx);
+    free(r->out);
+    free(r->text);
+    free(r);
+}
+
+/* ── Server ────────────────────────────────────────────── */
+
+static bool handle_client_msg(TUI_Remote *r, SDL_Event *e)
+{
+    uint8_t type;
+    const uint8_t *p, *end;
+    size_t len;
+
+    while (next_msg(r, &type, &p, &len)) {
+        end = p + len;
+        uint64_t a, b;
+        switch (type) {
+        case MSG_SIZE:
+            if (get_var(&p, end, &a) && get_var(&p, end, &b)
+                && a >= 1 && a <= MAX_DIM && b >= 1 && b <= MAX_DIM) {
+                r->want_cols = (int)a;
+                r->want_rows = (int)b;
+            }
+            break;
+        case MSG_ACK:
+            if (get_var(&p, end, &a) && get_var(&p, end, &b)) {
+                uint64_t rtt = now_us() - b;
+                r->stats.acks++;
+                r->stats.rtt_us_total += rtt;
+                if (rtt < r->stats.rtt_us_min) r->stats.rtt_us_min = rtt;
+                if (rtt > r->stats.rtt_us_max) r->stats.rtt_us_max = rtt;
+            }
+            break;
+        case MSG_EVENT: {
+            if (!get_var(&p, end, &a)) break;
+            memset(e, 0, sizeof *e);
+            e->type = (uint32_t)a;
+            e->common.timestamp = SDL_GetTicksNS();
+            if (a == SDL_EVENT_KEY_DOWN || a == SDL_EVENT_KEY_UP) {
+                uint64_t k, m, f;
+                if (!get_var(&p, end, &k) || !get_var(&p, end, &m)
+                    || !get_var(&p, end, &f))
+                    break;
+                e->key.key    = (SDL_Keycode)k;
+                e->key.mod    = (SDL_Keymod)m;
+                e->key.down   = (f & 1) != 0;
+                e->key.repeat = (f & 2) != 0;
+                return true;
+            }
+            if (a == SDL_EVENT_TEXT_INPUT) {
+                /* whole, however long the paste */
+                size_t n = (size_t)(end - p);
+                if (!grow(&r->text, &r->text_cap, n + 1)) break;
+                memcpy(r->text, p, n);
+                r->text[n] = '\0';
+                e->text.text = (const char *)r->text;
+                return true;
+            }
+            if (a == SDL_EVENT_QUIT) return true;
+            break;
+        }
+        default: break;
+        }
+    }
+    return false;
+}
+
+bool tui_remote_poll(TUI *t, SDL_Event *e)
+{
+    TUI_Remote *r = t->remote;
+
+    for (;;) {
+        if (handle_client_msg(r, e)) return true;
+        if (r->closed) {
+            if (r->quit_sent) return false;
+            r->quit_sent = true;
+            memset(e, 0, sizeof *e);
+            e->type = SDL_EVENT_QUIT;
+            return true;
+        }
+        uint64_t now = SDL_GetTicks();
+        int wait = r->next_frame_ms > now ? (int)(r->next_frame_ms - now) : 0;
+        struct pollfd pfd = {r->fd, POLLIN, 0};
+        if (poll(&pfd, 1, wait) <= 0) return false;
+        recv_some(r);
+    }
+}
+
+void tui_remote_size(TUI *t, int *cols, int *rows)
+{
+    TUI_Remote *r = t->remote;
+    if (r->want_cols > 0 && r->want_rows > 0) {
+        *cols = r->want_cols;
+        *rows = r->want_rows;
+    }
+}
+
+void tui_remote_present(TUI *t)
+{
+    TUI_Remote *r = t->remote;
+    int n = t->cols * t->rows;
+    r->next_frame_ms = SDL_GetTicks() + FRAME_MS;
+    if (r->closed) return;
+    /* a client that has not taken the last frame skips this one; prev
+       stays what it was sent, so the next delta covers both */
+    if (!flush(r)) {
+        r->stats.skipped++;
+        return;
+    }
+
+    if (r->cols != t->cols || r->rows != t->rows || !r->prev) {
+        free(r->prev);
+        r->prev = malloc((size_t)n * sizeof(TUI_Cell));
+        if (!r->prev) return;
+        r->cols = t->cols;
+        r->rows = t->rows;
+        r->key  = true;
+    }
+    size_t cap = TUI_DELTA_MAX(n);
+    if (r->enc_cap < cap) {
+        free(r->enc);
+        free(r->lz);
+        r->enc = malloc(cap);
+        r->lz  = malloc(TUI_LZ_MAX(cap));
+        r->enc_cap = r->enc && r->lz ? cap : 0;
+        if (!r->enc_cap) return;
+    }
+
+    size_t len = tui_delta_encode(r->key ? NULL : r->prev, t->cells, n,
+                                  r->enc);
+    if (len == 0 && !r->key) return;            /* nothing changed */
+
+    uint64_t changed = 0;
+    for (int i = 0; i < n; i++)
+        if (r->key || !cell_same(r->prev[i], t->cells[i])) changed++;
+    memcpy(r->prev, t->cells, (size_t)n * sizeof(TUI_Cell));
+
+    const uint8_t *body = r->enc;
+    uint8_t flags = r->key ? FR_KEY : 0;
+    size_t blen = len;
+    if (len > 64) {
+        size_t zl = tui_lz_compress(r->enc, len, r->lz);
+        if (zl < len) { body = r->lz; blen = zl; flags |= FR_LZ; }
+    }
+
+    if (!grow(&r->tx, &r->tx_cap, blen + 64)) return;
+    uint8_t *o = r->tx + 5;
+    size_t   h = 0;
+    o[h++] = flags;
+    h += put_var(o + h, ++r->seq);
+    h += put_var(o + h, now_us());
+    h += put_var(o + h, (uint64_t)t->cols);
+    h += put_var(o + h, (uint64_t)t->rows);
+    if (flags & FR_LZ) h += put_var(o + h, len);
+    memcpy(o + h, body, blen);
+
+    uint64_t before = r->stats.bytes_sent;
+    send_msg(r, MSG_FRAME, h + blen);
+    r->key = false;
+
+    r->stats.frames++;
+    r->stats.cells_changed += changed;
+    r->stats.bytes_raw     += changed * 3;
+    r->stats.bytes_last     = r->stats.bytes_sent - before;
+}
+
+bool tui_init_remote(TUI *t, int port)
+{
+    int ls = socket(AF_INET6, SOCK_STREAM, 0);
+    if (ls < 0) return SDL_SetError("socket: %s", strerror(errno));
+    int one = 1, zero = 0;
+    setsockopt(ls, SOL_SOCKET, SO_REUSEADDR, &one, sizeof one);
+    setsockopt(ls, IPPROTO_IPV6, IPV6_V6ONLY, &zero, sizeof zero);
+
+    struct sockaddr_in6 sa;
+    memset(&sa, 0, sizeof sa);
+    sa.sin6_family = AF_INET6;
+    sa.sin6_addr   = in6addr_any;
+    sa.sin6_port   = htons((uint16_t)port);
+    if (bind(ls, (struct sockaddr *)&sa, sizeof sa) != 0 || listen(ls, 1) != 0) {
+        close(ls);
+        return SDL_SetError("port %d: %s", port, strerror(errno));
+    }
+
+    SDL_Log("Waiting for a client on port %d", port);
+    int fd = accept(ls, NULL, NULL);
+    close(ls);
+    if (fd < 0) return SDL_SetError("accept: %s", strerror(errno));
+
+    TUI_Remote *r = remote_new(fd);
+    if (!r) { close(fd); return false; }
+
+    /* the client's first message announces its grid size */
+    SDL_Event dummy;
+    uint64_t deadline = SDL_GetTicks() + 5000;
+    while (!r->want_cols && !r->closed && SDL_GetTicks() < deadline) {
+        struct pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 100) > 0) recv_some(r);
+        handle_client_msg(r, &dummy);
+    }
+    if (!r->want_cols) {
+        tui_remote_free(r);
+        return SDL_SetError("client did not announce a grid size");
+    }
+
+    if (!tui_init_headless(t, r->want_cols, r->want_rows)) {
+        tui_remote_free(r);
+        return false;
+    }
+    t->remote = r;
+    return true;
+}
+
+void tui_remote_close(TUI *t)
+{
+    tui_remote_free(t->remote);
+    t->remote = NULL;
+}
+
+void tui_remote_stats(const TUI *t, TUI_RemoteStats *out)
+{
+    memset(out, 0, sizeof *out);
+    if (!t->remote) return;
+    *out = t->remote->stats;
+    if (!out->acks) out->rtt_us_min = 0;
+}
+
+/* ── Client ────────────────────────────────────────────── */
+
+TUI_Remote *tui_remote_connect(const char *host, int port)
+{
+    char service[16];
+    snprintf(service, sizeof service, "%d", port);
+    struct addrinfo hints, *res, *ai;
+    memset(&hints, 0, sizeof hints);
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    int rc = getaddrinfo(host, service, &hints, &res);
+    if (rc != 0) {
+        SDL_SetError("%s: %s", host, gai_strerror(rc));
+        return NULL;
+    }
+
+    int fd = -1;
+    for (ai = res; ai; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0) continue;
+        if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) break;
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+    if (fd < 0) {
+        SDL_SetError("connect %s:%d: %s", host, port, strerror(errno));
+        return NULL;
+    }
+
+    TUI_Remote *r = remote_new(fd);
+    if (!r) close(fd);
+    return r;
+}
+
+void tui_remote_send_event(TUI_Remote *r, const SDL_Event *e)
+{
+    size_t need = 64;
+    if (e->type == SDL_EVENT_TEXT_INPUT && e->text.text)
+        need += strlen(e->text.text);
+    if (!grow(&r->tx, &r->tx_cap, need)) return;
+
+    uint8_t *o = r->tx + 5;
+    size_t   n = put_var(o, e->type);
+    switch (e->type) {
+    case SDL_EVENT_KEY_DOWN:
+    case SDL_EVENT_KEY_UP:
+        n += put_var(o + n, e->key.key);
+        n += put_var(o + n, e->key.mod);
+        n += put_var(o + n, (e->key.down ? 1u : 0u) | (e->key.repeat ? 2u : 0u));
+        break;
+    case SDL_EVENT_TEXT_INPUT: {
+        size_t l = e->text.text ? strlen(e->text.text) : 0;
+        memcpy(o + n, e->text.text, l);
+        n += l;
+        break;
+    }
+    case SDL_EVENT_QUIT:
+        break;
+    default:
+        return;
+    }
+    send_msg(r, MSG_EVENT, n);
+}
+
+static void apply_frame(TUI_Remote *r, const uint8_t *p, size_t len)
+{
+    const uint8_t *end = p + len;
+    uint64_t seq, stamp, cols, rows, raw = 0;
+    if (p >= end) return;
+    uint8_t flags = *p++;
+    if (!get_var(&p, end, &seq) || !get_var(&p, end, &stamp)
+        || !get_var(&p, end, &cols) || !get_var(&p, end, &rows))
+        return;
+    if ((flags & FR_LZ) && !get_var(&p, end, &raw)) return;
+
+    if (cols < 1 || cols > MAX_DIM || rows < 1 || rows > MAX_DIM) return;
+    size_t n = (size_t)cols * (size_t)rows;
+    if ((flags & FR_LZ) && raw > TUI_DELTA_MAX(n)) return;
+    if ((int)cols != r->cols || (int)rows != r->rows) {
+        if (!(flags & FR_KEY)) return;   /* wait for the keyframe */
+        free(r->prev);
+        r->prev = calloc(n, sizeof(TUI_Cell));
+        if (!r->prev) { r->cols = r->rows = 0; return; }
+        r->cols = (int)cols;
+        r->rows = (int)rows;
+    }
+
+    const uint8_t *body = p;
+    size_t blen = (size_t)(end - p);
+    if (flags & FR_LZ) {
+        if (!grow(&r->lz, &r->enc_cap, (size_t)raw)) return;
+        blen = tui_lz_decompress(p, blen, r->lz, (size_t)raw);
+        if (blen != raw) return;
+        body = r->lz;
+    }
+    if (!tui_delta_decode(r->prev, (int)n, body, blen)) return;
+
+    r->stats.frames++;
+
+    uint8_t *o = r->tx + 5;
+    size_t   m = put_var(o, seq);
+    m += put_var(o + m, stamp);
+    send_msg(r, MSG_ACK, m);
+}
+
+bool tui_remote_update(TUI_Remote *r, TUI *t)
+{
+    if (!grow(&r->tx, &r->tx_cap, 64)) return false;
+    flush(r);
+
+    if (t->cols != r->want_cols || t->rows != r->want_rows) {
+        r->want_cols = t->cols;
+        r->want_rows = t->rows;
+        uint8_t *o = r->tx + 5;
+        size_t   n = put_var(o, (uint64_t)t->cols);
+        n += put_var(o + n, (uint64_t)t->rows);
+        send_msg(r, MSG_SIZE, n);
+    }
+
+    recv_some(r);
+    uint8_t type;
+    const uint8_t *p;
+    size_t len;
+    while (next_msg(r, &type, &p, &len))
+        if (type == MSG_FRAME) apply_frame(r, p, len);
+
+    /* copy the overlapping part of the mirror into the local grid */
+    int w = r->cols < t->cols ? r->cols : t->cols;
+    int h = r->rows < t->rows ? r->rows : t->rows;
+    for (int y = 0; y < h; y++)
+        memcpy(t->cells + (size_t)y * t->cols,
+               r->prev  + (size_t)y * r->cols, (size_t)w * sizeof(TUI_Cell));
+
+    return !r->closed;
+}
+
+#else /* _WIN32 */
+
+bool tui_init_remote(TUI *t, int port)
+{
+    (void)t; (void)port;
+    return SDL_SetError("remote cell stream needs BSD sockets");
+}
+void tui_remote_close(TUI *t) { (void)t; }
+void tui_remote_stats(const TUI *t, TUI_RemoteStats *out)
+{
+    (void)t;
+    memset(out, 0, sizeof *out);
+}
+TUI_Remote *tui_remote_connect(const char *host, int port)
+{
+    (void)host; (void)port;
+    SDL_SetError("remote cell stream needs BSD sockets");
+    return NULL;
+}
+bool tui_remote_update(TUI_Remote *r, TUI *t) { (void)r; (void)t; return false; }
+void tui_remote_send_event(TUI_Remote *r, const SDL_Event *e) { (void)r; (void)e; }
+void tui_remote_free(TUI_Remote *r) { (void)r; }
+void tui_remote_size(TUI *t, int *cols, int *rows) { (void)t; (void)cols; (void)rows; }
+void tui_remote_present(TUI *t) { (void)t; }
+bool tui_remote_poll(TUI *t, SDL_Event *e) { (void)t; (void)e; return false; }
+
+#endif
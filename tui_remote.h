@@ -0,0 +1,58 @@
+#ifndef TUI_REMOTE_H
+#define TUI_REMOTE_H
+
+#include "tui.h"
+
+/*
+ * Remote cell stream.
+ *
+ * A server runs the application against a headless context and, at every
+ * tui_end(), sends the cells that changed since the previous frame to a
+ * connected client.  Changed cells are grouped into spans, each span is
+ * run-length coded with one palette byte per colour change, and the whole
+ * frame is LZ-compressed when that makes it smaller.  The client mirrors
+ * the grid, copies it into its own window with the normal renderer and
+ * sends keyboard / text events (and its grid size) back.
+ */
+
+typedef struct {
+    uint64_t frames;
+    uint64_t skipped;            /* not sent: the client was still behind */
+    uint64_t cells_changed;
+    uint64_t bytes_raw;          /* 3 bytes per changed cell, uncoded */
+    uint64_t bytes_sent;         /* on the wire, including framing   */
+    uint64_t bytes_last;
+    uint64_t acks;
+    uint64_t rtt_us_total;       /* frame built .. client ack received */
+    uint64_t rtt_us_min, rtt_us_max;
+} TUI_RemoteStats;
+
+/* server side: headless context whose frames go to one client */
+bool tui_init_remote (TUI *t, int port);
+void tui_remote_close(TUI *t);
+void tui_remote_stats(const TUI *t, TUI_RemoteStats *out);
+
+/* client side */
+TUI_Remote *tui_remote_connect   (const char *host, int port);
+bool        tui_remote_update    (TUI_Remote *r, TUI *t);
+void        tui_remote_send_event(TUI_Remote *r, const SDL_Event *e);
+void        tui_remote_free      (TUI_Remote *r);
+
+/* frame codec, shared by both ends; buffers sized by the _MAX macros */
+#define TUI_DELTA_MAX(n) ((size_t)(n) * 4 + ((size_t)(n) / 2 + 1) * 20)
+#define TUI_LZ_MAX(n)    ((n) + (n) / 255 + 16)
+
+size_t tui_delta_encode(const TUI_Cell *prev, const TUI_Cell *cur, int n,
+                        uint8_t *out);
+bool   tui_delta_decode(TUI_Cell *cells, int n,
+                        const uint8_t *in, size_t len);
+size_t tui_lz_compress  (const uint8_t *in, size_t n, uint8_t *out);
+size_t tui_lz_decompress(const uint8_t *in, size_t n,
+                         uint8_t *out, size_t cap);
+
+/* hooks used by tui_begin / tui_end / tui_poll_event */
+void tui_remote_size   (TUI *t, int *cols, int *rows);
+void tui_remote_present(TUI *t);
+bool tui_remote_poll   (TUI *t, SDL_Event *e);
+
+#endif /* TUI_REMOTE_H */
@@ -0,0 +1,138 @@
+#define TUI_ALLOC_IMPL
+#include "tui_stats.h"
+#include "tui_alloc.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef TUI_STATS
+
+struct TUI_StatsState {
+    TUI_Counters  cur;                      /* first: see TUI_COUNT */
+    TUI_Counters  ring[TUI_STATS_WINDOW];   /* finished frames */
+    TUI_Counters  window, total;
+    int           next, frames;
+    uint64_t      allocs;                   /* global count at the last end */
+    TUI_Cell     *prev;                     /* the last frame's grid */
+    int           cols, rows;
+};
+
+/* ── Allocations ───────────────────────────────────────── */
+
+static SDL_AtomicInt allocs;
+
+void *tui_stats_malloc(size_t n)
+{
+    SDL_AddAtomicInt(&allocs, 1);
+    return malloc(n);
+}
+
+void *tui_stats_calloc(size_t n, size_t size)
+{
+    SDL_AddAtomicInt(&allocs, 1);
+    return calloc(n, size);
+}
+
+void *tui_stats_realloc(void *p, size_t n)
+{
+    SDL_AddAtomicInt(&allocs, 1);
+    return realloc(p, n);
+}
+
+/* ── Frames ────────────────────────────────────────────── */
+
+static void add(TUI_Counters *a, const TUI_Counters *b)
+{
+    a->cells_written += b->cells_written;
+    a->cells_changed += b->cells_changed;
+    a->draw_calls    += b->draw_calls;
+    a->color_mods    += b->color_mods;
+    a->upload_bytes  += b->upload_bytes;
+    a->allocs        += b->allocs;
+}
+
+static void sub(TUI_Counters *a, const TUI_Counters *b)
+{
+    a->cells_written -= b->cells_written;
+    a->cells_changed -= b->cells_changed;
+    a->draw_calls    -= b->draw_calls;
+    a->color_mods    -= b->color_mods;
+    a->upload_bytes  -= b->upload_bytes;
+    a->allocs        -= b->allocs;
+}
+
+void tui_stats_begin(TUI *t)
+{
+    if (!t->stats) t->stats = calloc(1, sizeof *t->stats);
+}
+
+/* count the cells that differ from the last frame and keep this one */
+static uint64_t changed(TUI_StatsState *s, const TUI *t)
+{
+    int n = t->cols * t->rows;
+    if (!s->prev || s->cols != t->cols || s->rows != t->rows) {
+        free(s->prev);
+        s->prev = malloc((size_t)n * sizeof(TUI_Cell));
+        s->cols = s->prev ? t->cols : 0;
+        s->rows = s->prev ? t->rows : 0;
+        if (s->prev) memcpy(s->prev, t->cells, (size_t)n * sizeof(TUI_Cell));
+        return (uint64_t)n;
+    }
+    uint64_t k = 0;
+    for (int i = 0; i < n; i++) {
+        const TUI_Cell *a = &s->prev[i], *b = &t->cells[i];
+        if (a->ch != b->ch || a->fg != b->fg || a->bg != b->bg) {
+            s->prev[i] = *b;
+            k++;
+        }
+    }
+    return k;
+}
+
+void tui_stats_end(TUI *t)
+{
+    TUI_StatsState *s = t->stats;
+    if (!s) return;
+    uint64_t a = (uint64_t)(uint32_t)SDL_GetAtomicInt(&allocs);
+    s->cur.allocs        = (uint32_t)(a - s->allocs);   /* wraps at 2^32 */
+    s->allocs            = a;
+    s->cur.cells_changed = changed(s, t);
+
+    if (s->frames == TUI_STATS_WINDOW) sub(&s->window, &s->ring[s->next]);
+    else s->frames++;
+    s->ring[s->next] = s->cur;
+    s->next = (s->next + 1) % TUI_STATS_WINDOW;
+    add(&s->window, &s->cur);
+    add(&s->total, &s->cur);
+    memset(&s->cur, 0, sizeof s->cur);
+}
+
+void tui_stats_close(TUI *t)
+{
+    if (!t->stats) return;
+    free(t->stats->prev);
+    free(t->stats);
+    t->stats = NULL;
+}
+
+bool tui_stats(const TUI *t, TUI_Stats *out)
+{
+    memset(out, 0, sizeof *out);
+    const TUI_StatsState *s = t->stats;
+    if (!s || s->frames == 0) return false;
+    out->frame  = s->ring[(s->next + TUI_STATS_WINDOW - 1) % TUI_STATS_WINDOW];
+    out->window = s->window;
+    out->total  = s->total;
+    out->frames = s->frames;
+    return true;
+}
+
+#else
+
+bool tui_stats(const TUI *t, TUI_Stats *out)
+{
+    (void)t;
+    memset(out, 0, sizeof *out);
+    return false;
+}
+
+#endif /* TUI_STATS */
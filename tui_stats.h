@@ -0,0 +1,66 @@
+#ifndef TUI_STATS_H
+#define TUI_STATS_H
+
+#include "tui.h"
+
+/*
+ * Per-frame counters.
+ *
+ * Built with -DTUI_STATS, the library counts what a frame costs beside
+ * its time: cells written by tui_putc() and the fill primitives, cells
+ * that differ from the previous frame, renderer calls and atlas colour
+ * changes in tui_end(), bytes of texture uploaded, and heap allocations
+ * made by the library on any thread (see tui_alloc.h).  tui_stats() reports the last frame,
+ * the sum over the last TUI_STATS_WINDOW frames and the total.
+ *
+ * Without TUI_STATS every counting site below expands to nothing and
+ * tui_stats() returns false.
+ */
+
+#define TUI_STATS_WINDOW 60
+
+typedef struct {
+    uint64_t cells_written;   /* by tui_putc and the fill primitives */
+    uint64_t cells_changed;   /* differ from the frame before */
+    uint64_t draw_calls;      /* renderer calls in tui_end */
+    uint64_t color_mods;      /* atlas colour-mod changes in tui_end */
+    uint64_t upload_bytes;    /* texture data uploaded */
+    uint64_t allocs;          /* malloc / calloc / realloc, all threads */
+} TUI_Counters;
+
+typedef struct {
+    TUI_Counters frame;       /* the last frame finished by tui_end */
+    TUI_Counters window;      /* the last `frames` frames */
+    TUI_Counters total;
+    int          frames;      /* up to TUI_STATS_WINDOW */
+} TUI_Stats;
+
+/* false when built without TUI_STATS or before the first frame */
+bool tui_stats(const TUI *t, TUI_Stats *out);
+
+/* ── Counting sites ────────────────────────────────────── */
+
+#ifdef TUI_STATS
+
+/* the counters of the frame being built lead t->stats */
+#define TUI_COUNT(t, field, n) \
+    do { if ((t)->stats) ((TUI_Counters *)(t)->stats)->field += (uint64_t)(n); } while (0)
+#define TUI_STATS_BEGIN(t) tui_stats_begin(t)
+#define TUI_STATS_END(t)   tui_stats_end(t)
+#define TUI_STATS_CLOSE(t) tui_stats_close(t)
+
+/* hooks used by tui_begin / tui_end / tui_destroy */
+void tui_stats_begin(TUI *t);
+void tui_stats_end  (TUI *t);
+void tui_stats_close(TUI *t);
+
+#else
+
+#define TUI_COUNT(t, field, n) ((void)0)
+#define TUI_STATS_BEGIN(t)     ((void)0)
+#define TUI_STATS_END(t)       ((void)0)
+#define TUI_STATS_CLOSE(t)     ((void)0)
+
+#endif /* TUI_STATS */
+
+#endif /* TUI_STATS_H */
@@ -0,0 +1,496 @@
+#include "tui_tape.h"
+#include "tui_remote.h"
+#include "tui_stats.h"
+#include <stdlib.h>
+#include <string.h>
+#include "tui_alloc.h"
+
+/* ── Tape format ───────────────────────────────────────── */
+/*
+ * header : "TUIT" u8 version u8[3] 0
+ * frame  : u8 flags  varint time_ms  varint cols  varint rows
+ *          varint raw_len  varint body_len  body
+ * index  : "TIDX" varint count, count x (varint dtime, varint doffset)
+ * footer : u64 index_offset  "TEND"
+ *
+ * time_ms is absolute from the start of the tape.  body is a span-coded
+ * delta against the previous frame (against nothing for keyframes),
+ * LZ-compressed when flags has TAPE_LZ.  The index lists keyframes only.
+ */
+
+#define TAPE_MAGIC   "TUIT"
+#define TAPE_VERSION 1
+#define TAPE_SLOTS   8
+#define TAPE_MAX_DIM 4096          /* as for remote frames */
+
+enum { TAPE_KEY = 1, TAPE_LZ = 2 };
+
+typedef struct { uint64_t time, offset; } TapeIndex;
+
+static size_t put_var(uint8_t *out, uint64_t v)
+{
+    size_t n = 0;
+    do {
+        out[n] = (uint8_t)(v & 0x7f);
+        v >>= 7;
+        if (v) out[n] |= 0x80;
+        n++;
+    } while (v);
+    return n;
+}
+
+static bool io_var(SDL_IOStream *io, uint64_t *v)
+{
+    uint64_t out = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t b;
+        if (SDL_ReadIO(io, &b, 1) != 1) return false;
+        out |= (uint64_t)(b & 0x7f) << shift;
+        if (!(b & 0x80)) { *v = out; return true; }
+    }
+    return false;
+}
+
+static bool grow(void **buf, size_t *cap, size_t need)
+{
+    if (need <= *cap) return true;
+    size_t nc = *cap ? *cap : 4096;
+    while (nc < need) nc *= 2;
+    void *nb = realloc(*buf, nc);
+    if (!nb) return false;
+    *buf = nb;
+    *cap = nc;
+    return true;
+}
+
+/* ── Writer ────────────────────────────────────────────── */
+
+typedef struct {
+    TUI_Cell *cells;
+    size_t    cap;             /* in cells */
+    int       cols, rows;
+    uint64_t  time;
+} TapeSlot;
+
+struct TUI_TapeWriter {
+    SDL_IOStream  *io;
+    SDL_Thread    *thread;
+    SDL_Mutex     *lock;
+    SDL_Condition *cond;
+    bool           stop;
+
+    TapeSlot       slots[TAPE_SLOTS];
+    int            head, count;     /* queued, oldest first */
+    uint64_t       start_ms;
+    int            key_ms;
+
+    /* owned by the writer thread */
+    TUI_Cell      *prev;
+    int            cols, rows;
+    uint64_t       last_key;
+    uint8_t       *enc, *lz;
+    size_t         enc_cap, lz_cap;
+    uint64_t       offset;
+    TapeIndex     *index;
+    size_t         index_len, index_cap;
+
+    TUI_TapeStats  stats;
+};
+
+static void write_frame(TUI_TapeWriter *w, const TapeSlot *s)
+{
+    int  n   = s->cols * s->rows;
+    bool key = !w->prev || s->cols != w->cols || s->rows != w->rows
+            || s->time - w->last_key >= (uint64_t)w->key_ms;
+
+    size_t cap = TUI_DELTA_MAX(n);
+    if (!grow((void **)&w->enc, &w->enc_cap, cap)
+        || !grow((void **)&w->lz, &w->lz_cap, TUI_LZ_MAX(cap)))
+        return;
+
+    size_t len = tui_delta_encode(key ? NULL : w->prev, s->cells, n, w->enc);
+    if (!key && len == 0) { w->stats.skipped++; return; }
+
+    uint8_t  flags = key ? TAPE_KEY : 0;
+    uint8_t *body  = w->enc;
+    size_t   blen  = len;
+    if (len > 64) {
+        size_t zl = tui_lz_compress(w->enc, len, w->lz);
+        if (zl < len) { body = w->lz; blen = zl; flags |= TAPE_LZ; }
+    }
+
+    if (key) {
+        if (w->index_len == w->index_cap) {
+            size_t nc = w->index_cap ? w->index_cap * 2 : 256;
+            TapeIndex *ni = realloc(w->index, nc * sizeof *ni);
+            if (!ni) return;
+            w->index     = ni;
+            w->index_cap = nc;
+        }
+        w->index[w->index_len++] = (TapeIndex){s->time, w->offset};
+        w->last_key = s->time;
+        w->stats.keyframes++;
+    }
+
+    uint8_t hdr[64];
+    size_t  h = 0;
+    hdr[h++] = flags;
+    h += put_var(hdr + h, s->time);
+    h += put_var(hdr + h, (uint64_t)s->cols);
+    h += put_var(hdr + h, (uint64_t)s->rows);
+    h += put_var(hdr + h, len);
+    h += put_var(hdr + h, blen);
+    SDL_WriteIO(w->io, hdr, h);
+    SDL_WriteIO(w->io, body, blen);
+    w->offset      += h + blen;
+    w->stats.bytes += h + blen;
+    w->stats.frames++;
+
+    if (s->cols != w->cols || s->rows != w->rows) {
+        free(w->prev);
+        w->prev = malloc((size_t)n * sizeof(TUI_Cell));
+        if (!w->prev) return;
+        w->cols = s->cols;
+        w->rows = s->rows;
+    }
+    memcpy(w->prev, s->cells, (size_t)n * sizeof(TUI_Cell));
+}
+
+static int writer_main(void *data)
+{
+    TUI_TapeWriter *w = data;
+    for (;;) {
+        SDL_LockMutex(w->lock);
+        while (w->count == 0 && !w->stop)
+            SDL_WaitCondition(w->cond, w->lock);
+        if (w->count == 0) {
+            SDL_UnlockMutex(w->lock);
+            break;
+        }
+        TapeSlot *s = &w->slots[w->head];
+        SDL_UnlockMutex(w->lock);
+
+        write_frame(w, s);
+
+        SDL_LockMutex(w->lock);
+        w->head = (w->head + 1) % TAPE_SLOTS;
+        w->count--;
+        SDL_UnlockMutex(w->lock);
+    }
+    return 0;
+}
+
+TUI_TapeWriter *tui_tape_open(const char *path, int key_ms)
+{
+    TUI_TapeWriter *w = calloc(1, sizeof *w);
+    if (!w) return NULL;
+    w->key_ms   = key_ms > 0 ? key_ms : 2000;
+    w->start_ms = SDL_GetTicks();
+    w->io       = SDL_IOFromFile(path, "wb");
+    w->lock     = SDL_CreateMutex();
+    w->cond     = SDL_CreateCondition();
+    if (!w->io || !w->lock || !w->cond) goto fail;
+
+    uint8_t hdr[8] = {'T', 'U', 'I', 'T', TAPE_VERSION, 0, 0, 0};
+    SDL_WriteIO(w->io, hdr, sizeof hdr);
+    w->offset = sizeof hdr;
+
+    w->thread = SDL_CreateThread(writer_main, "tui_tape", w);
+    if (!w->thread) goto fail;
+    return w;
+
+fail:
+    if (w->io)   SDL_CloseIO(w->io);
+    if (w->lock) SDL_DestroyMutex(w->lock);
+    if (w->cond) SDL_DestroyCondition(w->cond);
+    free(w);
+    return NULL;
+}
+
+void tui_tape_frame(TUI_TapeWriter *w, const TUI *t)
+{
+    SDL_LockMutex(w->lock);
+    if (w->count == TAPE_SLOTS) {
+        w->stats.dropped++;
+        SDL_UnlockMutex(w->lock);
+        return;
+    }
+    TapeSlot *s = &w->slots[(w->head + w->count) % TAPE_SLOTS];
+    SDL_UnlockMutex(w->lock);
+
+    /* the slot is ours until count is bumped */
+    size_t n = (size_t)t->cols * (size_t)t->rows;
+    if (s->cap < n) {
+        free(s->cells);
+        s->cells = malloc(n * sizeof(TUI_Cell));
+        s->cap   = s->cells ? n : 0;
+        if (!s->cells) return;
+    }
+    memcpy(s->cells, t->cells, n * sizeof(TUI_Cell));
+    s->cols = t->cols;
+    s->rows = t->rows;
+    s->time = SDL_GetTicks() - w->start_ms;
+
+    SDL_LockMutex(w->lock);
+    w->count++;
+    SDL_SignalCondition(w->cond);
+    SDL_UnlockMutex(w->lock);
+}
+
+void tui_tape_close(TUI_TapeWriter *w, TUI_TapeStats *stats)
+{
+    if (!w) return;
+    SDL_LockMutex(w->lock);
+    w->stop = true;
+    SDL_SignalCondition(w->cond);
+    SDL_UnlockMutex(w->lock);
+    SDL_WaitThread(w->thread, NULL);
+
+    /* keyframe index and footer */
+    uint64_t at = w->offset;
+    uint8_t  buf[32];
+    SDL_WriteIO(w->io, "TIDX", 4);
+    SDL_WriteIO(w->io, buf, put_var(buf, w->index_len));
+    uint64_t pt = 0, po = 0;
+    for (size_t i = 0; i < w->index_len; i++) {
+        size_t n = put_var(buf, w->index[i].time - pt);
+        n += put_var(buf + n, w->index[i].offset - po);
+        SDL_WriteIO(w->io, buf, n);
+        pt = w->index[i].time;
+        po = w->index[i].offset;
+    }
+    for (int i = 0; i < 8; i++) buf[i] = (uint8_t)(at >> (8 * i));
+    memcpy(buf + 8, "TEND", 4);
+    SDL_WriteIO(w->io, buf, 12);
+    SDL_CloseIO(w->io);
+
+    if (stats) *stats = w->stats;
+    for (int i = 0; i < TAPE_SLOTS; i++) free(w->slots[i].cells);
+    SDL_DestroyCondition(w->cond);
+    SDL_DestroyMutex(w->lock);
+    free(w->prev);
+    free(w->enc);
+    free(w->lz);
+    free(w->index);
+    free(w);
+}
+
+/* ── Player ────────────────────────────────────────────── */
+
+struct TUI_TapePlayer {
+    SDL_IOStream *io;
+    uint64_t      data_end;       /* first byte after the frames */
+    TapeIndex    *index;
+    size_t        index_len;
+    uint64_t      duration;
+
+    TUI_Cell     *cells;
+    int           cols, rows;
+    uint64_t      time;
+    uint64_t      pos;            /* offset of the next frame */
+
+    uint8_t      *body, *raw;
+    size_t        body_cap, raw_cap;
+};
+
+typedef struct {
+    uint8_t  flags;
+    uint64_t time, cols, rows, raw_len, body_len;
+} TapeHeader;
+
+/* false at the end of the frames, or where a damaged tape stops making
+   sense: every size is checked before it is allocated or read */
+static bool read_header(TUI_TapePlayer *p, uint64_t at, TapeHeader *h)
+{
+    if (at >= p->data_end) return false;
+    if (SDL_SeekIO(p->io, (Sint64)at, SDL_IO_SEEK_SET) < 0) return false;
+    if (SDL_ReadIO(p->io, &h->flags, 1) != 1
+        || !io_var(p->io, &h->time) || !io_var(p->io, &h->cols)
+        || !io_var(p->io, &h->rows) || !io_var(p->io, &h->raw_len)
+        || !io_var(p->io, &h->body_len))
+        return false;
+    if (h->cols < 1 || h->cols > TAPE_MAX_DIM
+        || h->rows < 1 || h->rows > TAPE_MAX_DIM)
+        return false;
+    Sint64 pos = SDL_TellIO(p->io);
+    if (pos < 0 || (uint64_t)pos > p->data_end
+        || h->body_len > p->data_end - (uint64_t)pos)
+        return false;
+    if (h->raw_len > TUI_DELTA_MAX(h->cols * h->rows)) return false;
+    return (h->flags & TAPE_LZ) || h->body_len == h->raw_len;
+}
+
+/* decode the frame at p->pos (header already read) into p->cells */
+static bool decode_frame(TUI_TapePlayer *p, const TapeHeader *h)
+{
+    int n = (int)h->cols * (int)h->rows;       /* bounded by read_header */
+    if ((int)h->cols != p->cols || (int)h->rows != p->rows) {
+        if (!(h->flags & TAPE_KEY)) return false;
+        free(p->cells);
+        p->cells = calloc((size_t)n, sizeof(TUI_Cell));
+        if (!p->cells) { p->cols = p->rows = 0; return false; }
+        p->cols = (int)h->cols;
+        p->rows = (int)h->rows;
+    }
+    if (!grow((void **)&p->body, &p->body_cap, (size_t)h->body_len)
+        || !grow((void **)&p->raw, &p->raw_cap, (size_t)h->raw_len))
+        return false;
+    if (SDL_ReadIO(p->io, p->body, (size_t)h->body_len) != h->body_len)
+        return false;
+
+    const uint8_t *src = p->body;
+    if (h->flags & TAPE_LZ) {
+        if (tui_lz_decompress(p->body, (size_t)h->body_len,
+                              p->raw, (size_t)h->raw_len) != h->raw_len)
+            return false;
+        src = p->raw;
+    }
+    p->pos  = (uint64_t)SDL_TellIO(p->io);
+    p->time = h->time;
+    return tui_delta_decode(p->cells, n, src, (size_t)h->raw_len);
+}
+
+/* rebuild the keyframe index from the frames (tape was not closed) */
+static void scan_index(TUI_TapePlayer *p)
+{
+    uint64_t at = 8;
+    size_t cap = 0;
+    TapeHeader h;
+    while (read_header(p, at, &h)) {
+        if (h.flags & TAPE_KEY) {
+            if (p->index_len == cap) {
+                cap = cap ? cap * 2 : 256;
+                TapeIndex *ni = realloc(p->index, cap * sizeof *ni);
+                if (!ni) return;
+                p->index = ni;
+            }
+            p->index[p->index_len++] = (TapeIndex){h.time, at};
+        }
+        p->duration = h.time;
+        at = (uint64_t)SDL_TellIO(p->io) + h.body_len;
+    }
+    p->data_end = at;
+}
+
+static bool read_index(TUI_TapePlayer *p, uint64_t size)
+{
+    uint8_t ft[12];
+    if (size < 8 + 12) return false;
+    if (SDL_SeekIO(p->io, (Sint64)(size - 12), SDL_IO_SEEK_SET) < 0
+        || SDL_ReadIO(p->io, ft, 12) != 12 || memcmp(ft + 8, "TEND", 4) != 0)
+        return false;
+    uint64_t at = 0;
+    for (int i = 0; i < 8; i++) at |= (uint64_t)ft[i] << (8 * i);
+
+    char tag[4];
+    uint64_t count;
+    if (at >= size || SDL_SeekIO(p->io, (Sint64)at, SDL_IO_SEEK_SET) < 0
+        || SDL_ReadIO(p->io, tag, 4) != 4 || memcmp(tag, "TIDX", 4) != 0
+        || !io_var(p->io, &count) || count > size)
+        return false;
+
+    p->index = malloc((size_t)(count ? count : 1) * sizeof *p->index);
+    if (!p->index) return false;
+    uint64_t t = 0, o = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t dt, dofs;
+        if (!io_var(p->io, &dt) || !io_var(p->io, &dofs)) return false;
+        t += dt;
+        o += dofs;
+        p->index[i] = (TapeIndex){t, o};
+    }
+    p->index_len = (size_t)count;
+    p->data_end  = at;
+
+    /* duration: walk forward from the last keyframe */
+    p->duration = count ? p->index[count - 1].time : 0;
+    TapeHeader h;
+    uint64_t pos = count ? p->index[count - 1].offset : 8;
+    while (read_header(p, pos, &h)) {
+        p->duration = h.time;
+        pos = (uint64_t)SDL_TellIO(p->io) + h.body_len;
+    }
+    return true;
+}
+
+TUI_TapePlayer *tui_tape_load(const char *path)
+{
+    TUI_TapePlayer *p = calloc(1, sizeof *p);
+    if (!p) return NULL;
+    p->io = SDL_IOFromFile(path, "rb");
+    char hdr[8];
+    if (!p->io || SDL_ReadIO(p->io, hdr, 8) != 8
+        || memcmp(hdr, TAPE_MAGIC, 4) != 0 || hdr[4] != TAPE_VERSION) {
+        SDL_SetError("%s: not a TUI tape", path);
+        tui_tape_free(p);
+        return NULL;
+    }
+
+    Sint64 size = SDL_GetIOSize(p->io);
+    if (!read_index(p, (uint64_t)size)) {
+        free(p->index);
+        p->index     = NULL;
+        p->index_len = 0;
+        p->data_end  = (uint64_t)size;
+        scan_index(p);
+    }
+    if (!p->index_len || !tui_tape_seek(p, 0)) {
+        SDL_SetError("%s: tape holds no frames", path);
+        tui_tape_free(p);
+        return NULL;
+    }
+    return p;
+}
+
+void tui_tape_free(TUI_TapePlayer *p)
+{
+    if (!p) return;
+    if (p->io) SDL_CloseIO(p->io);
+    free(p->index);
+    free(p->cells);
+    free(p->body);
+    free(p->raw);
+    free(p);
+}
+
+bool tui_tape_seek(TUI_TapePlayer *p, uint64_t ms)
+{
+    /* last keyframe at or before ms */
+    size_t lo = 0, hi = p->index_len;
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi) / 2;
+        if (p->index[mid].time <= ms) lo = mid;
+        else hi = mid;
+    }
+
+    /* rolling forward is cheaper unless a newer keyframe lies between */
+    TapeHeader h;
+    bool forward = p->cells && p->index[lo].time <= p->time && p->time <= ms;
+    if (!forward
+        && (!read_header(p, p->index[lo].offset, &h) || !decode_frame(p, &h)))
+        return false;
+
+    /* then roll deltas forward up to ms */
+    while (read_header(p, p->pos, &h) && h.time <= ms)
+        if (!decode_frame(p, &h)) return false;
+    return true;
+}
+
+bool tui_tape_next(TUI_TapePlayer *p)
+{
+    TapeHeader h;
+    return read_header(p, p->pos, &h) && decode_frame(p, &h);
+}
+
+uint64_t tui_tape_time    (const TUI_TapePlayer *p) { return p->time; }
+uint64_t tui_tape_duration(const TUI_TapePlayer *p) { return p->duration; }
+
+void tui_tape_blit(const TUI_TapePlayer *p, TUI *t)
+{
+    int w = p->cols < t->cols ? p->cols : t->cols;
+    int h = p->rows < t->rows ? p->rows : t->rows;
+    for (int y = 0; y < h; y++)
+        memcpy(t->cells + (size_t)y * t->cols,
+               p->cells + (size_t)y * p->cols, (size_t)w * sizeof(TUI_Cell));
+    TUI_COUNT(t, cells_written, w * h);
+}
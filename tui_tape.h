@@ -0,0 +1,38 @@
+#ifndef TUI_TAPE_H
+#define TUI_TAPE_H
+
+#include "tui.h"
+
+/*
+ * Screen tapes: seekable recordings of what the grid showed.
+ *
+ * The writer stores a full keyframe of the cells every key_ms and only the
+ * changed cells in between, using the same span codec and LZ compression
+ * as the remote stream.  Encoding and file I/O run on a background thread;
+ * tui_tape_frame() on the UI thread is a single copy of the grid into a
+ * free slot (the frame is dropped, and counted, if every slot is busy).
+ * Closing the tape appends a keyframe index, so the player can seek to any
+ * time by decoding from the nearest keyframe only.
+ */
+
+typedef struct TUI_TapeWriter TUI_TapeWriter;
+typedef struct TUI_TapePlayer TUI_TapePlayer;
+
+typedef struct {
+    uint64_t frames, keyframes, skipped, dropped;
+    uint64_t bytes;
+} TUI_TapeStats;
+
+TUI_TapeWriter *tui_tape_open (const char *path, int key_ms);
+void            tui_tape_frame(TUI_TapeWriter *w, const TUI *t);
+void            tui_tape_close(TUI_TapeWriter *w, TUI_TapeStats *stats);
+
+TUI_TapePlayer *tui_tape_load    (const char *path);
+void            tui_tape_free    (TUI_TapePlayer *p);
+bool            tui_tape_seek    (TUI_TapePlayer *p, uint64_t ms);
+bool            tui_tape_next    (TUI_TapePlayer *p);
+uint64_t        tui_tape_time    (const TUI_TapePlayer *p);
+uint64_t        tui_tape_duration(const TUI_TapePlayer *p);
+void            tui_tape_blit    (const TUI_TapePlayer *p, TUI *t);
+
+#endif /* TUI_TAPE_H */
@@ -0,0 +1,535 @@
+#include "tui_tree.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "tui_alloc.h"
+
+#define NO_PARENT   UINT32_MAX
+#define ROW_LOADING 0x80000000u     /* row standing in for a node's children */
+#define ROW_NODE(r) ((r) & ~ROW_LOADING)
+
+enum { N_BRANCH = 1, N_OPEN = 2, N_LOADED = 4, N_LOADING = 8 };
+
+typedef struct {
+    uint32_t parent;
+    uint32_t first, count;          /* children, once loaded */
+    uint32_t name;                  /* offset in names */
+    uint32_t depth;
+    uint32_t flags;
+    uint64_t key;
+} Node;
+
+typedef struct {
+    const char *s;                  /* for sorting, once the list is done */
+    uint32_t    name;               /* offset in the list's names */
+    bool        branch;
+    uint64_t    key;
+} Item;
+
+struct TUI_TreeList {
+    TUI_TreeList   *next;           /* the tree's loads, UI thread only */
+    const TUI_Tree *tree;
+    TUI_Job        *job;
+    uint32_t        node;
+    uint64_t        key;
+
+    /* written by the worker until done is set */
+    Item           *items;
+    int             n, cap;
+    char           *names;
+    size_t          used, ncap;
+    bool            failed;         /* out of memory */
+    SDL_AtomicInt   count;          /* items so far, published now and then */
+    SDL_AtomicInt   done;
+    char            path[];
+};
+
+struct TUI_Tree {
+    TUI_JobPool  *pool;
+    TUI_JobToken  tok;
+    TUI_TreeLoad  load;
+    void         *user;
+    int           flags;
+
+    Node         *nodes;
+    uint32_t      n, cap;
+    char         *names;
+    size_t        used, ncap;
+
+    uint32_t     *rows;             /* visible, in display order */
+    int           nrows, rcap;
+    int           selected, scroll;
+    int           page;             /* rows at the last draw */
+    int           confirmed;
+
+    TUI_TreeList *loads;            /* in flight, or done but not applied */
+    int           loading;
+};
+
+/* ── Storage ───────────────────────────────────────────── */
+
+static bool grow(void **p, size_t *cap, size_t want, size_t size)
+{
+    if (want <= *cap) return true;
+    size_t n = *cap ? *cap * 2 : 256;
+    while (n < want) n *= 2;
+    void *q = realloc(*p, n * size);
+    if (!q) return false;
+    *p   = q;
+    *cap = n;
+    return true;
+}
+
+/* appends s with its terminator; the offset in *off */
+static bool put_name(char **buf, size_t *used, size_t *cap,
+                     const char *s, uint32_t *off)
+{
+    size_t n = strlen(s) + 1;
+    if (*used + n > UINT32_MAX
+        || !grow((void **)buf, cap, *used + n, 1)) return false;
+    memcpy(*buf + *used, s, n);
+    *off   = (uint32_t)*used;
+    *used += n;
+    return true;
+}
+
+static bool reserve_nodes(TUI_Tree *tr, uint32_t extra)
+{
+    size_t cap = tr->cap;
+    if (tr->n + (uint64_t)extra >= ROW_LOADING) return false;
+    if (!grow((void **)&tr->nodes, &cap, tr->n + extra, sizeof *tr->nodes))
+        return false;
+    tr->cap = (uint32_t)cap;
+    return true;
+}
+
+/* ── Rows ──────────────────────────────────────────────── */
+
+static int row_depth(const TUI_Tree *tr, uint32_t r)
+{
+    return (int)tr->nodes[ROW_NODE(r)].depth + (r & ROW_LOADING ? 1 : 0);
+}
+
+/* replace rows [at, at + remove) with insert rows for the caller to fill */
+static bool splice(TUI_Tree *tr, int at, int remove, int insert)
+{
+    size_t cap = (size_t)tr->rcap;
+    if (!grow((void **)&tr->rows, &cap, (size_t)tr->nrows - remove + insert,
+              sizeof *tr->rows)) return false;
+    tr->rcap = (int)cap;
+    memmove(tr->rows + at + insert, tr->rows + at + remove,
+            (size_t)(tr->nrows - at - remove) * sizeof *tr->rows);
+    tr->nrows += insert - remove;
+
+    if (tr->selected >= at + remove)
+        tr->selected += insert - remove;
+    else if (tr->selected >= at && remove > 0)
+        tr->selected = at > 0 ? at - 1 : 0;      /* its row went away */
+    return true;
+}
+
+/* the visible rows below node, written to out if not NULL; returns how
+   many there are */
+static int descendants(const TUI_Tree *tr, uint32_t node, uint32_t *out)
+{
+    const Node *p = &tr->nodes[node];
+    if (!(p->flags & N_OPEN)) return 0;
+    if (!(p->flags & N_LOADED)) {
+        if (out) out[0] = node | ROW_LOADING;
+        return 1;
+    }
+    int k = 0;
+    for (uint32_t c = p->first; c < p->first + p->count; c++) {
+        if (out) out[k] = c;
+        k++;
+        k += descendants(tr, c, out ? out + k : NULL);
+    }
+    return k;
+}
+
+static bool shown(const TUI_Tree *tr, uint32_t node)
+{
+    for (uint32_t a = node; a != NO_PARENT; a = tr->nodes[a].parent)
+        if (!(tr->nodes[a].flags & N_OPEN)) return false;
+    return true;
+}
+
+/* ── Loading ───────────────────────────────────────────── */
+
+static int cmp_items(const void *a, const void *b)
+{
+    const Item *x = a, *y = b;
+    if (x->branch != y->branch) return x->branch ? -1 : 1;
+    return strcmp(x->s, y->s);
+}
+
+static void load_main(TUI_Job *j, void *user)
+{
+    TUI_TreeList *l = user;
+    const TUI_Tree *tr = l->tree;
+    l->job = j;
+    tr->load(l, l->path, l->key, tr->user);
+    if ((tr->flags & TUI_TREE_SORT) && l->n > 1) {
+        for (int i = 0; i < l->n; i++)
+            l->items[i].s = l->names + l->items[i].name;
+        qsort(l->items, (size_t)l->n, sizeof *l->items, cmp_items);
+    }
+    SDL_SetAtomicInt(&l->count, l->n);
+    SDL_SetAtomicInt(&l->done, 1);
+}
+
+/* attach a finished list's children to its node, in place of the
+   node's loading row */
+static void apply(TUI_Tree *tr, TUI_TreeList *l)
+{
+    uint32_t id = l->node;
+    uint32_t k  = (uint32_t)l->n;
+    size_t   ncap = tr->ncap;
+    if (!reserve_nodes(tr, k)
+        || tr->used + l->used > UINT32_MAX
+        || !grow((void **)&tr->names, &ncap, tr->used + l->used, 1))
+        k = 0;                              /* shown as empty */
+    tr->ncap = ncap;
+
+    uint32_t base = (uint32_t)tr->used, first = tr->n;
+    if (k) {
+        memcpy(tr->names + base, l->names, l->used);
+        tr->used += l->used;
+    }
+    for (uint32_t i = 0; i < k; i++) {
+        const Item *it = &l->items[i];
+        tr->nodes[first + i] = (Node){
+            .parent = id, .name = base + it->name,
+            .depth  = tr->nodes[id].depth + 1,
+            .flags  = it->branch ? N_BRANCH : 0, .key = it->key,
+        };
+    }
+    tr->n += k;
+    Node *nd = &tr->nodes[id];
+    nd->first  = first;
+    nd->count  = k;
+    nd->flags  = (nd->flags & ~N_LOADING) | N_LOADED;
+
+    if (!shown(tr, id)) return;
+    for (int r = 0; r < tr->nrows; r++) {
+        if (tr->rows[r] != (id | ROW_LOADING)) continue;
+        int m = descendants(tr, id, NULL);
+        if (splice(tr, r, 1, m)) descendants(tr, id, tr->rows + r);
+        break;
+    }
+}
+
+static void list_free(TUI_TreeList *l)
+{
+    free(l->items);
+    free(l->names);
+    free(l);
+}
+
+static bool start_load(TUI_Tree *tr, uint32_t id)
+{
+    char path[4096];
+    int  len = tui_tree_path(tr, (int)id, path, sizeof path);
+    TUI_TreeList *l = calloc(1, sizeof *l + (size_t)len + 1);
+    if (!l) return false;
+    memcpy(l->path, path, (size_t)len + 1);
+    l->tree = tr;
+    l->node = id;
+    l->key  = tr->nodes[id].key;
+    tr->nodes[id].flags |= N_LOADING;
+
+    if (tr->pool && tui_job_submit(tr->pool, load_main, NULL, l, &tr->tok)) {
+        l->next   = tr->loads;
+        tr->loads = l;
+        tr->loading++;
+    } else {
+        load_main(NULL, l);                 /* no pool: list it now */
+        apply(tr, l);
+        list_free(l);
+    }
+    return true;
+}
+
+/* pick up the lists the workers have finished */
+static void update(TUI_Tree *tr)
+{
+    for (TUI_TreeList **pp = &tr->loads; *pp; ) {
+        TUI_TreeList *l = *pp;
+        if (!SDL_GetAtomicInt(&l->done)) {
+            pp = &l->next;
+            continue;
+        }
+        *pp = l->next;
+        tr->loading--;
+        apply(tr, l);
+        list_free(l);
+    }
+}
+
+bool tui_tree_list_add(TUI_TreeList *l, const char *name, uint64_t key,
+                       bool branch)
+{
+    if (l->failed || tui_tree_list_cancelled(l)) return false;
+    size_t cap = (size_t)l->cap;
+    uint32_t off;
+    if (l->n == INT32_MAX
+        || !grow((void **)&l->items, &cap, (size_t)l->n + 1, sizeof *l->items)
+        || !put_name(&l->names, &l->used, &l->ncap, name, &off)) {
+        l->failed = true;
+        return false;
+    }
+    l->cap = (int)cap;
+    l->items[l->n++] = (Item){NULL, off, branch, key};
+    if ((l->n & 1023) == 0) SDL_SetAtomicInt(&l->count, l->n);
+    return true;
+}
+
+bool tui_tree_list_cancelled(const TUI_TreeList *l)
+{
+    return l->job && tui_job_cancelled(l->job);
+}
+
+/* ── Expanding ─────────────────────────────────────────── */
+
+static void expand(TUI_Tree *tr, int row)
+{
+    uint32_t id = tr->rows[row];
+    if (id & ROW_LOADING) return;
+    uint32_t fl = tr->nodes[id].flags;
+    if (!(fl & N_BRANCH) || (fl & N_OPEN)) return;
+    if (!(fl & (N_LOADED | N_LOADING)) && !start_load(tr, id)) return;
+
+    tr->nodes[id].flags |= N_OPEN;
+    int k = descendants(tr, id, NULL);
+    if (splice(tr, row + 1, 0, k)) descendants(tr, id, tr->rows + row + 1);
+    else tr->nodes[id].flags &= ~N_OPEN;
+}
+
+static void collapse(TUI_Tree *tr, int row)
+{
+    uint32_t id = tr->rows[row];
+    if ((id & ROW_LOADING) || !(tr->nodes[id].flags & N_OPEN)) return;
+    tr->nodes[id].flags &= ~N_OPEN;
+    int d = (int)tr->nodes[id].depth, end = row + 1;
+    while (end < tr->nrows && row_depth(tr, tr->rows[end]) > d) end++;
+    splice(tr, row + 1, end - row - 1, 0);
+}
+
+static void toggle(TUI_Tree *tr, int row)
+{
+    uint32_t id = tr->rows[row];
+    if (id & ROW_LOADING) return;
+    if (!(tr->nodes[id].flags & N_BRANCH)) tr->confirmed = (int)id;
+    else if (tr->nodes[id].flags & N_OPEN) collapse(tr, row);
+    else expand(tr, row);
+}
+
+/* ── API ───────────────────────────────────────────────── */
+
+TUI_Tree *tui_tree_new(TUI_JobPool *pool, const char *root, uint64_t key,
+                       TUI_TreeLoad load, void *user, int flags)
+{
+    TUI_Tree *tr = calloc(1, sizeof *tr);
+    if (!tr) return NULL;
+    tr->pool      = pool;
+    tr->load      = load;
+    tr->user      = user;
+    tr->flags     = flags;
+    tr->confirmed = -1;
+
+    uint32_t off;
+    if (!reserve_nodes(tr, 1)
+        || !put_name(&tr->names, &tr->used, &tr->ncap, root, &off)
+        || !splice(tr, 0, 0, 1)) {
+        tui_tree_free(tr);
+        return NULL;
+    }
+    tr->nodes[0] = (Node){ .parent = NO_PARENT, .name = off,
+                           .flags = N_BRANCH, .key = key };
+    tr->n        = 1;
+    tr->rows[0]  = 0;
+    tr->selected = 0;
+    expand(tr, 0);
+    return tr;
+}
+
+void tui_tree_free(TUI_Tree *tr)
+{
+    if (!tr) return;
+    if (tr->pool) {
+        tui_job_cancel(&tr->tok);
+        tui_job_wait(tr->pool, &tr->tok);
+    }
+    for (TUI_TreeList *l = tr->loads, *next; l; l = next) {
+        next = l->next;
+        list_free(l);
+    }
+    free(tr->nodes);
+    free(tr->names);
+    free(tr->rows);
+    free(tr);
+}
+
+void tui_draw_tree(TUI *t, int x, int y, int w, int h, TUI_Tree *tr,
+                   bool focused, uint8_t fg, uint8_t bg,
+                   uint8_t sf, uint8_t sb, uint8_t dim)
+{
+    update(tr);
+    if (w < 4 || h < 1) return;
+    tr->page = h;
+    if (tr->selected >= tr->nrows) tr->selected = tr->nrows - 1;
+    if (tr->selected < 0) tr->selected = 0;
+    if (tr->selected < tr->scroll) tr->scroll = tr->selected;
+    if (tr->selected >= tr->scroll + h) tr->scroll = tr->selected - h + 1;
+    if (tr->scroll > tr->nrows - h) tr->scroll = tr->nrows - h;
+    if (tr->scroll < 0) tr->scroll = 0;
+
+    /* the last column is left to the scroll marks */
+    TUI_Id base = t->id;
+    int iw = w - 1, max_indent = iw / 2;
+    for (int i = 0; i < h; i++) {
+        int r = tr->scroll + i;
+        if (base) t->id = (TUI_Id)(base + i);
+        if (r >= tr->nrows) {
+            tui_fill(t, x, y + i, iw, 1, ' ', fg, bg);
+            continue;
+        }
+        bool sel = r == tr->selected;
+        uint8_t f = sel ? sf : fg;
+        uint8_t b = sel ? sb : bg;
+        tui_fill(t, x, y + i, iw, 1, ' ', f, b);
+        if (sel) tui_putc(t, x, y + i, focused && !t->blink_on ? ' ' : '>',
+                          f, b);
+
+        uint32_t v = tr->rows[r];
+        int ind = 2 + 2 * row_depth(tr, v);
+        if (ind > max_indent) ind = max_indent;
+        if (v & ROW_LOADING) {
+            int n = 0;
+            for (TUI_TreeList *l = tr->loads; l; l = l->next)
+                if (l->node == ROW_NODE(v)) n = SDL_GetAtomicInt(&l->count);
+            char msg[48];
+            snprintf(msg, sizeof msg, n ? "loading... %d" : "loading...", n);
+            tui_puts_clip(t, x + ind, y + i, iw - ind, msg,
+                          sel ? f : dim, b);
+            continue;
+        }
+        const Node *nd = &tr->nodes[v];
+        char mark = !(nd->flags & N_BRANCH)        ? ' '
+                  : !(nd->flags & N_OPEN)          ? '+'
+                  : (nd->flags & N_LOADED) && !nd->count ? ' ' : '-';
+        tui_putc(t, x + ind, y + i, mark, sel ? f : dim, b);
+        tui_puts_clip(t, x + ind + 2, y + i, iw - ind - 2,
+                      tr->names + nd->name, f, b);
+    }
+    t->id = base;
+    tui_scroll_marks(t, x + w - 1, y, h, tr->scroll > 0,
+                     tr->scroll + h < tr->nrows, dim, bg);
+}
+
+void tui_tree_move(TUI_Tree *tr, int rows)
+{
+    int64_t s = (int64_t)tr->selected + rows;
+    if (s > tr->nrows - 1) s = tr->nrows - 1;
+    if (s < 0) s = 0;
+    tr->selected = (int)s;
+}
+
+void tui_tree_click(TUI_Tree *tr, int row)
+{
+    int r = tr->scroll + row;
+    if (row < 0 || r >= tr->nrows) return;
+    if (r == tr->selected) toggle(tr, r);
+    else tr->selected = r;
+}
+
+bool tui_tree_handle(TUI_Tree *tr, const SDL_Event *e)
+{
+    if (e->type != SDL_EVENT_KEY_DOWN || tr->nrows == 0) return false;
+    int page = tr->page > 1 ? tr->page - 1 : 1;
+    int r = tr->selected;
+    uint32_t v = tr->rows[r];
+    const Node *nd = &tr->nodes[ROW_NODE(v)];
+    bool open = !(v & ROW_LOADING) && (nd->flags & N_OPEN);
+
+    switch (e->key.key) {
+    case SDLK_UP:       tui_tree_move(tr, -1);        break;
+    case SDLK_DOWN:     tui_tree_move(tr, 1);         break;
+    case SDLK_PAGEUP:   tui_tree_move(tr, -page);     break;
+    case SDLK_PAGEDOWN: tui_tree_move(tr, page);      break;
+    case SDLK_HOME:     tui_tree_move(tr, -tr->nrows); break;
+    case SDLK_END:      tui_tree_move(tr, tr->nrows);  break;
+    case SDLK_RIGHT:
+        if (!open) expand(tr, r);
+        else if (r + 1 < tr->nrows
+                 && row_depth(tr, tr->rows[r + 1]) > row_depth(tr, v))
+            tr->selected = r + 1;
+        break;
+    case SDLK_LEFT:
+        if (open) {
+            collapse(tr, r);
+        } else {
+            int d = row_depth(tr, v);
+            while (r > 0 && row_depth(tr, tr->rows[r]) >= d) r--;
+            tr->selected = r;
+        }
+        break;
+    case SDLK_RETURN: case SDLK_KP_ENTER: case SDLK_SPACE:
+        if (e->key.key == SDLK_SPACE && !(nd->flags & N_BRANCH)) break;
+        toggle(tr, r);
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
+
+int tui_tree_selected(const TUI_Tree *tr)
+{
+    if (tr->nrows == 0) return -1;
+    uint32_t v = tr->rows[tr->selected];
+    return v & ROW_LOADING ? -1 : (int)v;
+}
+
+int tui_tree_confirmed(TUI_Tree *tr)
+{
+    int c = tr->confirmed;
+    tr->confirmed = -1;
+    return c;
+}
+
+const char *tui_tree_name(const TUI_Tree *tr, int node)
+{
+    if (node < 0 || (uint32_t)node >= tr->n) return "";
+    return tr->names + tr->nodes[node].name;
+}
+
+uint64_t tui_tree_key(const TUI_Tree *tr, int node)
+{
+    if (node < 0 || (uint32_t)node >= tr->n) return 0;
+    return tr->nodes[node].key;
+}
+
+int tui_tree_path(const TUI_Tree *tr, int node, char *buf, int size)
+{
+    if (size <= 0) return 0;
+    buf[0] = '\0';
+    if (node < 0 || (uint32_t)node >= tr->n) return 0;
+    const Node *nd = &tr->nodes[node];
+    int len = nd->parent == NO_PARENT
+            ? 0 : tui_tree_path(tr, (int)nd->parent, buf, size);
+    if (len > 0 && buf[len - 1] != '/' && len < size - 1) buf[len++] = '/';
+    const char *s = tr->names + nd->name;
+    int n = (int)strlen(s);
+    if (n > size - 1 - len) n = size - 1 - len;
+    memcpy(buf + len, s, (size_t)n);
+    buf[len + n] = '\0';
+    return len + n;
+}
+
+void tui_tree_info(const TUI_Tree *tr, TUI_TreeInfo *out)
+{
+    out->nodes   = (int)tr->n;
+    out->rows    = tr->nrows;
+    out->loading = tr->loading;
+}
@@ -0,0 +1,71 @@
+#ifndef TUI_TREE_H
+#define TUI_TREE_H
+
+#include "tui.h"
+#include "tui_job.h"
+
+/*
+ * Tree view with lazily loaded children.
+ *
+ * Nothing below a node is known until it is first expanded.  Then the
+ * tree's load callback lists the node's children on a TUI_JobPool worker,
+ * and a "loading" row stands in for them.  The finished list is picked up
+ * by the next draw.  Children of a node are stored next to each other in
+ * one node array and stay loaded when the node is collapsed.
+ *
+ * The rows on screen come from a flat array of the visible nodes in
+ * display order.  Expanding a node splices its visible descendants in
+ * after its row and collapsing cuts them out.  Either way the cost is one
+ * move of the rows below; nothing is rebuilt.
+ *
+ * Keys: Up/Down, PageUp/PageDown, Home/End move; Right expands or steps
+ * into a node; Left collapses or steps out; Enter and Space toggle a
+ * branch, and Enter on a leaf confirms it.
+ */
+
+#define TUI_TREE_SORT 1          /* flag: branches first, then by name */
+
+typedef struct TUI_Tree     TUI_Tree;
+typedef struct TUI_TreeList TUI_TreeList;
+
+/* runs on a worker: add the children of the node at path (the names from
+   the root joined with '/'), whose key is key */
+typedef void (*TUI_TreeLoad)(TUI_TreeList *out, const char *path,
+                             uint64_t key, void *user);
+
+typedef struct {
+    int nodes;                   /* loaded so far, the root included */
+    int rows;                    /* visible */
+    int loading;                 /* lists in flight */
+} TUI_TreeInfo;
+
+/* pool NULL: children are listed on the caller; the root starts open */
+TUI_Tree *tui_tree_new (TUI_JobPool *pool, const char *root, uint64_t key,
+                        TUI_TreeLoad load, void *user, int flags);
+void      tui_tree_free(TUI_Tree *tr);          /* cancels and waits */
+
+void tui_draw_tree  (TUI *t, int x, int y, int w, int h, TUI_Tree *tr,
+                     bool focused, uint8_t fg, uint8_t bg,
+                     uint8_t sf, uint8_t sb, uint8_t dim);
+bool tui_tree_handle(TUI_Tree *tr, const SDL_Event *e);
+void tui_tree_move  (TUI_Tree *tr, int rows);   /* the selection */
+/* a click on the row-th row of the last draw: select, then toggle */
+void tui_tree_click (TUI_Tree *tr, int row);
+
+/* nodes are numbered from 0, the root; -1 for none */
+int         tui_tree_selected (const TUI_Tree *tr);
+int         tui_tree_confirmed(TUI_Tree *tr);   /* once per Enter */
+const char *tui_tree_name     (const TUI_Tree *tr, int node);
+uint64_t    tui_tree_key      (const TUI_Tree *tr, int node);
+/* path of node as given to the loader; returns its length */
+int         tui_tree_path     (const TUI_Tree *tr, int node,
+                               char *buf, int size);
+void        tui_tree_info     (const TUI_Tree *tr, TUI_TreeInfo *out);
+
+/* for use inside the load callback; false once the list should stop
+   (cancelled, or out of memory) */
+bool tui_tree_list_add      (TUI_TreeList *l, const char *name,
+                             uint64_t key, bool branch);
+bool tui_tree_list_cancelled(const TUI_TreeList *l);
+
+#endif /* TUI_TREE_H */
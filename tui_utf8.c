@@ -0,0 +1,188 @@
+#include "tui_utf8.h"
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <emmintrin.h>
+#define UTF8_SSE2 1
+#endif
+
+/* grapheme break classes, numbered as in tui_utf8_gen.py */
+enum {
+    B_OTHER, B_CR, B_LF, B_CONTROL, B_EXTEND, B_ZWJ, B_RI, B_PREPEND,
+    B_SPACING, B_L, B_V, B_T, B_LV, B_LVT, B_PICT
+};
+
+#include "tui_utf8_tab.h"
+
+#define MASK(bits) ((1u << (bits)) - 1)
+
+/* width in bits 0-1, break class in bits 2-5 */
+static unsigned props(uint32_t cp)
+{
+    if (cp > 0x10FFFF) cp = TUI_UTF8_INVALID;
+    unsigned b = utf8_stage1[cp >> TUI_UTF8_SHIFT1];
+    b = utf8_stage2[(b << (TUI_UTF8_SHIFT1 - TUI_UTF8_SHIFT2))
+                    + ((cp >> TUI_UTF8_SHIFT2)
+                       & MASK(TUI_UTF8_SHIFT1 - TUI_UTF8_SHIFT2))];
+    return utf8_stage3[(b << TUI_UTF8_SHIFT2) + (cp & MASK(TUI_UTF8_SHIFT2))];
+}
+
+#define P_WIDTH(p) ((int)((p) & 3))
+#define P_BREAK(p) ((int)((p) >> 2))
+
+/* ── Decoding ──────────────────────────────────────────── */
+
+int tui_utf8_decode(const char *s, int n, uint32_t *cp)
+{
+    const unsigned char *u = (const unsigned char *)s;
+    *cp = TUI_UTF8_INVALID;
+    if (n <= 0) return 0;
+
+    unsigned c = u[0];
+    if (c < 0x80) { *cp = c; return 1; }
+    int len;
+    uint32_t v, min;
+    if      (c >= 0xc2 && c <= 0xdf) { len = 2; v = c & 0x1f; min = 0x80; }
+    else if (c >= 0xe0 && c <= 0xef) { len = 3; v = c & 0x0f; min = 0x800; }
+    else if (c >= 0xf0 && c <= 0xf4) { len = 4; v = c & 0x07; min = 0x10000; }
+    else return 1;
+    if (len > n) return 1;
+    for (int i = 1; i < len; i++) {
+        if ((u[i] & 0xc0) != 0x80) return 1;
+        v = v << 6 | (u[i] & 0x3f);
+    }
+    if (v < min || v > 0x10FFFF || (v >= 0xd800 && v <= 0xdfff)) return 1;
+    *cp = v;
+    return len;
+}
+
+int tui_cp_width(uint32_t cp)
+{
+    return P_WIDTH(props(cp));
+}
+
+int tui_utf8_ascii(const char *s, int n)
+{
+    int i = 0;
+#ifdef UTF8_SSE2
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+        int m = _mm_movemask_epi8(v);             /* top bit of each byte */
+        if (m) return i + __builtin_ctz((unsigned)m);
+    }
+#else
+    for (; i + 8 <= n; i += 8) {
+        uint64_t v;
+        memcpy(&v, s + i, sizeof v);
+        if (v & 0x8080808080808080ull) break;
+    }
+#endif
+    while (i < n && (unsigned char)s[i] < 0x80) i++;
+    return i;
+}
+
+/* ── Grapheme clusters ─────────────────────────────────── */
+
+/* UAX #29 rules GB3 .. GB13: no break between a and b?  zwj_pict is set
+   when a is a ZWJ ending "ExtPict Extend*", ri counts the regional
+   indicators up to a */
+static bool joins(int a, int b, bool zwj_pict, int ri)
+{
+    if (a == B_CR && b == B_LF) return true;
+    if (a == B_CR || a == B_LF || a == B_CONTROL) return false;
+    if (b == B_CR || b == B_LF || b == B_CONTROL) return false;
+    switch (a) {
+    case B_L:
+        if (b == B_L || b == B_V || b == B_LV || b == B_LVT) return true;
+        break;
+    case B_LV: case B_V:
+        if (b == B_V || b == B_T) return true;
+        break;
+    case B_LVT: case B_T:
+        if (b == B_T) return true;
+        break;
+    }
+    if (b == B_EXTEND || b == B_ZWJ || b == B_SPACING) return true;
+    if (a == B_PREPEND) return true;
+    if (a == B_ZWJ && b == B_PICT) return zwj_pict;
+    if (a == B_RI && b == B_RI) return ri % 2 == 1;
+    return false;
+}
+
+int tui_utf8_cluster(const char *s, int n, int *width)
+{
+    uint32_t cp;
+    int i = tui_utf8_decode(s, n, &cp);
+    if (i == 0) {
+        if (width) *width = 0;
+        return 0;
+    }
+    unsigned p = props(cp);
+    int  a    = P_BREAK(p);
+    int  w    = cp < 0x80 || cp == TUI_UTF8_INVALID ? 1 : P_WIDTH(p);
+    bool pict = a == B_PICT;                  /* "ExtPict Extend*" so far */
+    bool zwj_pict = false;
+    int  ri   = a == B_RI;
+
+    while (i < n) {
+        int l = tui_utf8_decode(s + i, n - i, &cp);
+        unsigned q = props(cp);
+        int b = P_BREAK(q);
+        if (!joins(a, b, zwj_pict, ri)) break;
+
+        if (a == B_CR) w++;                   /* CR LF: each byte a cell */
+        else if (P_WIDTH(q) > w) w = P_WIDTH(q);
+        if (cp == 0xfe0f) w = 2;              /* emoji presentation */
+        if (b == B_RI) { ri++; w = 2; }       /* a flag */
+        zwj_pict = b == B_ZWJ && pict;
+        pict     = b == B_PICT || (pict && b == B_EXTEND);
+        a  = b;
+        i += l;
+    }
+    if (width) *width = w;
+    return i;
+}
+
+/* ── Measuring ─────────────────────────────────────────── */
+
+/* leading ASCII bytes that are whole clusters: the last one of a run may
+   take the marks that follow it */
+static int ascii_run(const char *s, int n)
+{
+    int a = tui_utf8_ascii(s, n);
+    return a < n && a > 0 ? a - 1 : a;
+}
+
+int tui_utf8_width(const char *s, int n)
+{
+    int w = 0, i = 0;
+    while (i < n) {
+        int a = ascii_run(s + i, n - i);
+        w += a;
+        i += a;
+        if (i >= n) break;
+        int cw;
+        i += tui_utf8_cluster(s + i, n - i, &cw);
+        w += cw;
+    }
+    return w;
+}
+
+int tui_utf8_fit(const char *s, int n, int cols, int *width)
+{
+    int w = 0, i = 0;
+    while (i < n && w < cols) {
+        int a = ascii_run(s + i, n - i);
+        if (a > cols - w) a = cols - w;
+        w += a;
+        i += a;
+        if (i >= n || w >= cols) break;
+        int cw, l = tui_utf8_cluster(s + i, n - i, &cw);
+        if (w + cw > cols) break;
+        w += cw;
+        i += l;
+    }
+    if (width) *width = w;
+    return i;
+}
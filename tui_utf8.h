@@ -0,0 +1,36 @@
+#ifndef TUI_UTF8_H
+#define TUI_UTF8_H
+
+#include "tui.h"
+
+/*
+ * UTF-8 text measurement.
+ *
+ * Width and grapheme break class of every code point come from a three
+ * stage lookup table generated by tui_utf8_gen.py (`make tables`).  A
+ * grapheme cluster -- a base with its combining marks, a Hangul syllable,
+ * an emoji ZWJ sequence, a flag -- is what takes cells on screen: 0, 1 or
+ * 2 of them, as many as its widest code point.  Emoji presentation
+ * (U+FE0F) and flag pairs are 2 wide.
+ *
+ * ASCII is measured without the tables: tui_utf8_ascii() finds runs of
+ * bytes below 0x80 sixteen at a time, and each such byte is one cell,
+ * controls included, as tui_putc() draws it.
+ * Bytes that are not valid UTF-8 are one cell each, drawn as '?'.
+ */
+
+#define TUI_UTF8_INVALID 0xFFFD
+
+/* bytes of the code point at s (1 for an invalid byte, cp then INVALID) */
+int tui_utf8_decode (const char *s, int n, uint32_t *cp);
+int tui_cp_width    (uint32_t cp);              /* 0, 1 or 2 cells */
+/* leading bytes of s below 0x80 */
+int tui_utf8_ascii  (const char *s, int n);
+/* bytes of the grapheme cluster at s, and its width in cells */
+int tui_utf8_cluster(const char *s, int n, int *width);
+int tui_utf8_width  (const char *s, int n);
+/* bytes of the whole clusters of s that fit in cols cells; their width
+   in *width */
+int tui_utf8_fit    (const char *s, int n, int cols, int *width);
+
+#endif /* TUI_UTF8_H */
@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""Generate tui_utf8_tab.h: display width and grapheme break class of
+every code point, packed into a three-stage lookup table.
+
+    python3 tui_utf8_gen.py > tui_utf8_tab.h      (make tables)
+
+General categories and East Asian widths come from the interpreter's
+unicodedata.  It carries no Grapheme_Cluster_Break or
+Extended_Pictographic property, so those are derived from the categories
+plus the short lists below (UAX #29, emoji-data.txt).
+"""
+import sys
+import unicodedata as ud
+
+NCP = 0x110000
+
+# grapheme break classes, as in tui_utf8.c
+OTHER, CR, LF, CONTROL, EXTEND, ZWJ, RI, PREPEND, SPACING, \
+    L, V, T, LV, LVT, PICT = range(15)
+
+PREPEND_CPS = [(0x0600, 0x0605), (0x06DD, 0x06DD), (0x070F, 0x070F),
+               (0x0890, 0x0891), (0x08E2, 0x08E2), (0x0D4E, 0x0D4E),
+               (0x110BD, 0x110BD), (0x110CD, 0x110CD), (0x111C2, 0x111C3),
+               (0x1193F, 0x1193F), (0x11941, 0x11941), (0x11A3A, 0x11A3A),
+               (0x11A84, 0x11A89), (0x11D46, 0x11D46)]
+
+# Other_Grapheme_Extend: spacing marks and others that extend anyway
+EXTEND_CPS = [(0x09BE, 0x09BE), (0x09D7, 0x09D7), (0x0B3E, 0x0B3E),
+              (0x0B57, 0x0B57), (0x0BBE, 0x0BBE), (0x0BD7, 0x0BD7),
+              (0x0CC2, 0x0CC2), (0x0CD5, 0x0CD6), (0x0D3E, 0x0D3E),
+              (0x0D57, 0x0D57), (0x0DCF, 0x0DCF), (0x0DDF, 0x0DDF),
+              (0x1B35, 0x1B35), (0x200C, 0x200C), (0x302E, 0x302F),
+              (0xFF9E, 0xFF9F), (0x1133E, 0x1133E), (0x11357, 0x11357),
+              (0x114B0, 0x114B0), (0x114BD, 0x114BD), (0x115AF, 0x115AF),
+              (0x11930, 0x11930), (0x1D165, 0x1D165), (0x1D16E, 0x1D172),
+              (0x1F3FB, 0x1F3FF), (0xE0020, 0xE007F)]
+
+SPACING_CPS = [(0x0E33, 0x0E33), (0x0EB3, 0x0EB3)]
+
+PICT_CPS = [(0x00A9, 0x00A9), (0x00AE, 0x00AE), (0x203C, 0x203C),
+            (0x2049, 0x2049), (0x2122, 0x2122), (0x2139, 0x2139),
+            (0x2194, 0x2199), (0x21A9, 0x21AA), (0x231A, 0x231B),
+            (0x2328, 0x2328), (0x2388, 0x2388), (0x23CF, 0x23CF),
+            (0x23E9, 0x23F3), (0x23F8, 0x23FA), (0x24C2, 0x24C2),
+            (0x25AA, 0x25AB), (0x25B6, 0x25B6), (0x25C0, 0x25C0),
+            (0x25FB, 0x25FE), (0x2600, 0x2605), (0x2607, 0x2612),
+            (0x2614, 0x2685), (0x2690, 0x2705), (0x2708, 0x2712),
+            (0x2714, 0x2714), (0x2716, 0x2716), (0x271D, 0x271D),
+            (0x2721, 0x2721), (0x2728, 0x2728), (0x2733, 0x2734),
+            (0x2744, 0x2744), (0x2747, 0x2747), (0x274C, 0x274C),
+            (0x274E, 0x274E), (0x2753, 0x2755), (0x2757, 0x2757),
+            (0x2763, 0x2767), (0x2795, 0x2797), (0x27A1, 0x27A1),
+            (0x27B0, 0x27B0), (0x27BF, 0x27BF), (0x2934, 0x2935),
+            (0x2B05, 0x2B07), (0x2B1B, 0x2B1C), (0x2B50, 0x2B50),
+            (0x2B55, 0x2B55), (0x3030, 0x3030), (0x303D, 0x303D),
+            (0x3297, 0x3297), (0x3299, 0x3299), (0x1F000, 0x1F0FF),
+            (0x1F10D, 0x1F10F), (0x1F12F, 0x1F12F), (0x1F16C, 0x1F171),
+            (0x1F17E, 0x1F17F), (0x1F18E, 0x1F18E), (0x1F191, 0x1F19A),
+            (0x1F1AD, 0x1F1E5), (0x1F201, 0x1F20F), (0x1F21A, 0x1F21A),
+            (0x1F22F, 0x1F22F), (0x1F232, 0x1F23A), (0x1F23C, 0x1F23F),
+            (0x1F249, 0x1F3FA), (0x1F400, 0x1F53D), (0x1F546, 0x1F64F),
+            (0x1F680, 0x1F6FF), (0x1F774, 0x1F77F), (0x1F7D5, 0x1F7FF),
+            (0x1F80C, 0x1F80F), (0x1F848, 0x1F84F), (0x1F85A, 0x1F85F),
+            (0x1F888, 0x1F88F), (0x1F8AE, 0x1F8FF), (0x1F90C, 0x1F93A),
+            (0x1F93C, 0x1F945), (0x1F947, 0x1FAFF), (0x1FC00, 0x1FFFD)]
+
+# wide even where unassigned
+WIDE_CPS = [(0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF),
+            (0x20000, 0x2FFFD), (0x30000, 0x3FFFD)]
+
+ZERO_CPS = [(0x1160, 0x11FF), (0xD7B0, 0xD7FF), (0x200B, 0x200B)]
+
+
+def in_ranges(ranges):
+    s = set()
+    for a, b in ranges:
+        s.update(range(a, b + 1))
+    return s
+
+
+def classify():
+    prepend, extend = in_ranges(PREPEND_CPS), in_ranges(EXTEND_CPS)
+    spacing, pict = in_ranges(SPACING_CPS), in_ranges(PICT_CPS)
+    wide, zero = in_ranges(WIDE_CPS), in_ranges(ZERO_CPS)
+    props = bytearray(NCP)
+    for cp in range(NCP):
+        c = chr(cp)
+        cat = ud.category(c)
+
+        if cp == 0x0D:                          brk = CR
+        elif cp == 0x0A:                        brk = LF
+        elif cp == 0x200D:                      brk = ZWJ
+        elif cp in prepend:                     brk = PREPEND
+        elif cp in extend or cat in ('Mn', 'Me'):
+            brk = EXTEND
+        elif cat in ('Cc', 'Zl', 'Zp') or (cat == 'Cf' and cp != 0x00AD):
+            brk = CONTROL
+        elif 0x1F1E6 <= cp <= 0x1F1FF:          brk = RI
+        elif cp in spacing or cat == 'Mc':      brk = SPACING
+        elif 0x1100 <= cp <= 0x115F or 0xA960 <= cp <= 0xA97C:
+            brk = L
+        elif 0x1160 <= cp <= 0x11A7 or 0xD7B0 <= cp <= 0xD7C6:
+            brk = V
+        elif 0x11A8 <= cp <= 0x11FF or 0xD7CB <= cp <= 0xD7FB:
+            brk = T
+        elif 0xAC00 <= cp <= 0xD7A3:
+            brk = LV if (cp - 0xAC00) % 28 == 0 else LVT
+        elif cp in pict:                        brk = PICT
+        else:                                   brk = OTHER
+
+        if cp in zero or brk in (EXTEND, ZWJ, CONTROL, CR, LF) \
+                or cat in ('Mn', 'Me', 'Cc', 'Zl', 'Zp'):
+            width = 0
+        elif cp in wide or ud.east_asian_width(c) in ('W', 'F'):
+            width = 2
+        else:
+            width = 1
+        props[cp] = width | brk << 2
+    return props
+
+
+def blocks(data, size):
+    """split data into blocks of size and dedupe them: (index, blocks)"""
+    seen, index, out = {}, [], []
+    for i in range(0, len(data), size):
+        b = tuple(data[i:i + size])
+        if b not in seen:
+            seen[b] = len(out)
+            out.append(b)
+        index.append(seen[b])
+    return index, out
+
+
+def build(props, s1, s2):
+    idx2, b3 = blocks(props, 1 << s2)
+    t1, b2 = blocks(idx2, 1 << (s1 - s2))
+    t2 = [v for b in b2 for v in b]
+    t3 = [v for b in b3 for v in b]
+    size = sum(len(t) * (1 if max(t) < 256 else 2) for t in (t1, t2, t3))
+    return size, t1, t2, t3, len(b2), len(b3)
+
+
+def emit(name, vals, out, per=16):
+    ctype = 'uint8_t' if max(vals) < 256 else 'uint16_t'
+    out.append('static const %s %s[%d] = {' % (ctype, name, len(vals)))
+    for i in range(0, len(vals), per):
+        out.append('    ' + ','.join('%d' % v for v in vals[i:i + per]) + ',')
+    out.append('};')
+
+
+def main():
+    props = classify()
+    best = None
+    for s1 in range(9, 15):
+        for s2 in range(4, s1):
+            r = build(props, s1, s2)
+            if best is None or r[0] < best[0][0]:
+                best = (r, s1, s2)
+    (size, t1, t2, t3, n2, n3), s1, s2 = best
+
+    out = ['/* generated by tui_utf8_gen.py from Unicode %s; do not edit */'
+           % ud.unidata_version,
+           '/* %d bytes: %d + %d entries, %d + %d unique blocks */'
+           % (size, len(t1), len(t2), n2, n3),
+           '',
+           '#define TUI_UTF8_SHIFT1 %d' % s1,
+           '#define TUI_UTF8_SHIFT2 %d' % s2,
+           '']
+    emit('utf8_stage1', t1, out)
+    out.append('')
+    emit('utf8_stage2', t2, out)
+    out.append('')
+    emit('utf8_stage3', t3, out, 32)
+    sys.stdout.write('\n'.join(out) + '\n')
+
+
+main()
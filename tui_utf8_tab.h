@@ -0,0 +1,569 @@
+/* generated by tui_utf8_gen.py from Unicode 14.0.0; do not edit */
+/* 15584 bytes: 2176 + 2912 entries, 91 + 474 unique blocks */
+
+#define TUI_UTF8_SHIFT1 9
+#define TUI_UTF8_SHIFT2 4
+
+static const uint8_t utf8_stage1[2176] = {
+    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+    16,17,18,19,20,21,22,23,24,25,26,26,26,26,26,26,
+    26,26,26,26,26,26,27,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,28,29,30,31,32,33,34,35,36,37,38,32,33,34,
+    35,36,37,38,32,33,34,35,36,37,38,39,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,40,41,42,43,
+    44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,
+    10,60,61,26,26,26,26,62,10,10,63,26,26,26,26,26,
+    26,26,10,64,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,10,65,26,66,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,67,26,
+    26,26,26,26,26,26,26,68,69,70,71,72,10,73,26,74,
+    75,76,26,77,78,26,79,80,81,82,83,84,85,86,87,88,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    89,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,90,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,90,
+};
+
+static const uint16_t utf8_stage2[2912] = {
+    0,1,2,2,2,2,2,3,1,1,4,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    5,5,5,5,5,5,5,6,7,2,8,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,9,2,2,2,2,2,2,2,
+    2,2,2,10,2,11,2,2,12,13,5,14,15,2,16,17,
+    18,19,2,2,20,5,2,21,2,2,2,2,2,22,23,2,
+    24,25,2,5,26,2,2,2,2,2,27,28,2,2,20,29,
+    2,30,31,32,2,33,34,2,32,35,2,2,36,5,37,5,
+    38,2,2,39,40,41,42,2,43,44,45,46,47,48,49,50,
+    51,44,45,52,53,54,55,56,57,8,45,58,59,60,49,61,
+    62,44,45,63,64,65,49,66,67,68,69,70,71,72,55,34,
+    73,74,45,75,76,77,49,78,79,74,45,80,81,82,49,83,
+    84,74,2,85,86,87,49,2,88,89,2,90,91,92,55,93,
+    10,2,2,94,95,96,97,97,98,2,99,100,101,102,97,97,
+    2,103,2,104,105,2,106,107,108,109,5,110,111,34,97,97,
+    2,2,112,113,2,114,115,116,117,118,2,2,119,2,2,2,
+    120,120,120,120,120,120,121,121,121,121,122,123,123,123,123,123,
+    2,2,2,2,124,125,2,2,124,2,2,126,127,128,2,2,
+    2,127,2,2,2,129,2,106,2,130,2,2,2,2,2,131,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,106,2,2,2,2,2,132,
+    2,133,2,134,2,135,136,137,2,2,2,138,139,140,130,130,
+    141,130,2,2,2,2,2,132,142,2,143,2,2,2,2,144,
+    2,32,145,146,147,2,148,17,2,2,96,2,130,149,2,2,
+    2,150,2,2,2,151,152,153,130,130,148,5,154,97,97,97,
+    155,2,2,156,157,2,20,158,159,2,160,2,2,2,161,162,
+    2,2,163,164,165,2,2,2,132,2,2,12,66,166,167,168,
+    2,2,2,2,2,2,2,2,2,2,2,2,5,5,5,5,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,131,2,2,131,169,2,148,2,2,2,170,170,171,2,172,
+    173,2,174,175,176,2,177,178,32,106,2,2,60,5,5,179,
+    2,2,180,176,2,2,2,2,96,181,182,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,183,184,2,2,2,2,2,185,2,2,2,186,2,187,188,
+    2,2,189,97,34,97,2,2,2,2,2,2,180,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,190,191,192,2,2,193,
+    194,195,196,196,197,198,196,199,200,201,202,203,204,205,206,207,
+    208,209,210,211,212,213,214,2,2,215,216,217,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,218,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    219,220,2,2,2,221,2,222,2,223,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,224,225,
+    2,2,119,2,2,2,226,227,2,189,228,228,228,228,5,5,
+    2,2,2,2,2,148,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,229,230,97,97,97,97,97,231,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,232,97,97,97,97,233,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,2,2,2,2,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,96,97,2,2,224,234,2,235,2,2,2,2,2,236,
+    2,2,2,2,2,2,2,2,2,2,2,2,34,237,97,238,
+    239,2,240,130,2,2,2,66,241,2,2,242,243,130,5,244,
+    2,2,245,2,246,247,120,248,38,2,2,249,250,251,252,32,
+    2,2,253,254,255,102,2,256,2,2,2,257,258,259,260,261,
+    262,263,228,2,2,2,96,2,2,2,2,2,2,2,264,130,
+    265,266,267,268,267,269,267,265,266,267,268,267,269,267,265,266,
+    267,268,267,269,267,265,266,267,268,267,269,267,265,266,267,268,
+    267,269,267,265,266,267,268,267,269,267,265,266,267,268,267,269,
+    267,265,266,267,268,267,269,267,265,266,267,268,267,269,267,265,
+    266,267,268,267,269,267,265,266,267,268,267,269,267,265,266,267,
+    268,267,269,267,265,266,267,268,267,269,267,265,266,267,268,267,
+    269,267,265,266,267,268,267,269,267,265,266,267,268,267,269,267,
+    265,266,267,268,267,269,267,265,266,267,268,267,269,267,265,266,
+    267,268,267,269,267,265,266,267,268,267,269,267,265,266,267,268,
+    267,269,267,265,266,267,268,267,269,267,265,266,267,268,267,269,
+    267,265,266,267,268,267,269,267,265,266,267,268,267,269,267,265,
+    266,267,268,267,269,267,265,266,267,268,267,269,267,265,266,267,
+    268,267,269,267,265,266,267,268,267,269,267,265,266,267,268,267,
+    269,267,265,266,267,268,267,269,267,265,266,267,268,267,269,267,
+    265,266,267,268,267,269,267,265,266,267,268,267,269,267,265,266,
+    267,268,267,269,267,265,266,267,268,267,270,121,271,123,123,272,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    189,273,2,274,275,2,2,2,2,2,2,2,276,277,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,238,2,2,226,97,97,2,
+    5,97,5,97,97,97,97,170,2,2,2,2,2,2,2,278,
+    97,97,97,97,97,97,10,2,2,235,2,32,279,280,281,282,
+    283,2,128,284,148,148,97,97,2,2,2,2,2,2,2,34,
+    285,2,2,286,2,2,2,2,32,106,60,97,97,2,2,287,
+    97,97,97,97,97,97,97,97,2,106,2,2,2,60,21,96,
+    2,2,288,2,34,2,2,289,2,290,2,2,291,144,97,97,
+    2,2,2,2,2,2,2,2,2,148,130,2,2,291,2,96,
+    2,2,66,2,2,2,292,293,293,294,8,295,97,97,97,97,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,189,2,144,66,97,223,2,2,296,97,97,97,97,
+    297,2,2,298,2,223,2,2,2,32,78,97,97,97,2,299,
+    2,300,2,301,97,97,97,97,2,2,2,302,2,238,2,2,
+    303,304,2,305,132,132,2,2,2,2,97,97,2,2,306,189,
+    2,2,2,307,2,308,2,309,2,310,311,97,97,97,97,97,
+    2,2,2,2,132,97,97,97,2,2,2,276,2,2,2,312,
+    2,2,313,130,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,2,32,2,2,314,315,97,97,97,97,
+    2,2,66,2,27,316,97,2,317,97,97,2,96,97,2,189,
+    318,2,2,319,320,238,2,321,159,2,2,322,323,2,132,130,
+    324,2,325,326,327,2,2,328,159,2,2,329,330,2,10,17,
+    2,8,331,332,97,97,97,97,333,290,130,2,2,224,334,130,
+    335,44,45,336,337,338,339,340,97,97,97,97,97,97,97,97,
+    2,2,2,341,342,343,315,97,2,2,2,344,345,130,97,97,
+    97,97,97,97,97,97,97,97,2,2,224,346,21,347,97,97,
+    2,2,2,348,349,130,106,97,2,2,350,351,130,97,97,97,
+    2,129,352,2,189,97,97,97,97,97,97,97,97,97,97,97,
+    2,2,331,353,97,97,97,97,97,97,2,2,2,2,2,354,
+    355,356,2,357,358,130,97,97,97,97,6,2,2,359,360,97,
+    361,2,2,362,363,364,2,2,365,366,276,2,2,2,2,132,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    45,2,367,368,144,2,106,2,2,369,370,371,97,97,97,97,
+    372,2,2,373,374,130,375,2,376,377,130,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,2,378,
+    97,97,97,97,97,97,97,97,97,97,97,60,2,2,2,379,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,130,97,97,97,97,97,97,
+    2,2,2,2,2,2,32,17,2,2,2,2,2,2,2,2,
+    2,2,2,2,380,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,2,2,2,2,2,2,276,
+    2,2,32,381,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    2,2,2,2,189,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    2,2,2,132,2,32,251,2,2,2,2,32,130,2,148,382,
+    2,2,2,383,144,384,8,385,2,97,97,97,97,97,97,97,
+    97,97,97,97,2,2,2,2,2,34,97,97,97,97,97,97,
+    2,2,2,2,386,387,388,388,389,324,97,97,97,97,390,391,
+    2,2,2,2,2,2,34,106,132,392,393,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    5,5,394,5,395,2,2,2,2,2,2,2,380,97,97,97,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,144,
+    2,2,11,2,2,2,396,397,398,2,399,2,2,2,34,97,
+    2,2,2,2,400,97,97,97,97,97,97,97,97,97,2,380,
+    2,2,2,2,2,189,2,132,97,97,97,97,97,97,97,97,
+    2,2,2,2,2,170,2,2,2,136,401,402,403,2,2,2,
+    404,405,2,406,407,74,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,308,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,408,2,2,2,
+    5,5,5,409,5,5,410,252,411,412,13,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    2,32,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    413,414,415,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    2,2,106,320,251,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,2,50,97,2,2,416,301,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,417,32,
+    2,2,2,2,2,2,2,2,2,2,2,2,418,395,97,97,
+    2,2,2,2,419,251,97,97,97,97,97,97,97,97,97,97,
+    97,97,97,97,97,97,97,10,2,2,2,17,97,97,97,97,
+    10,2,2,148,97,97,97,97,97,97,97,97,97,97,97,97,
+    403,2,420,421,422,423,424,425,384,96,426,96,97,97,97,315,
+    97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+    205,196,427,196,196,196,196,196,196,428,199,429,430,429,196,431,
+    432,2,186,2,2,2,433,434,435,436,437,438,438,438,439,440,
+    441,442,443,444,445,438,438,438,438,438,438,438,438,438,438,438,
+    438,438,446,447,438,438,438,448,438,198,438,438,449,198,438,450,
+    438,438,438,451,452,438,438,438,438,438,438,438,438,438,438,453,
+    438,438,438,454,455,438,456,206,196,457,205,196,196,196,196,458,
+    438,438,438,438,438,2,2,2,438,438,438,438,459,460,458,428,
+    2,2,2,2,2,2,2,461,2,2,2,2,2,462,438,438,
+    463,2,2,2,464,465,2,2,464,2,466,467,438,438,438,438,
+    463,438,438,468,469,438,438,438,438,438,438,438,438,438,438,438,
+    196,196,196,196,196,428,470,438,438,438,438,438,438,438,438,438,
+    2,2,2,2,2,2,2,2,2,471,2,2,34,97,97,130,
+    438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,
+    438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,
+    438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,
+    438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,472,
+    473,97,5,5,5,5,5,5,97,97,97,97,97,97,97,97,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,97,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,148,
+};
+
+static const uint8_t utf8_stage3[7584] = {
+    12,12,12,12,12,12,12,12,12,12,8,12,12,4,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,12,
+    1,1,1,1,1,1,1,1,1,57,1,1,1,1,57,1,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,2,2,2,1,1,1,1,1,1,1,2,1,2,1,1,
+    1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,16,16,16,16,16,16,16,1,1,1,1,1,1,
+    2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,2,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,1,16,1,16,16,1,16,16,1,16,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,
+    29,29,29,29,29,29,1,1,1,1,1,1,1,1,1,1,16,16,16,16,16,16,16,16,16,16,16,1,12,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,16,16,16,16,16,16,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,16,16,16,16,16,16,16,29,1,16,16,16,16,16,16,1,1,16,16,1,16,16,16,16,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,29,1,16,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    16,16,16,16,16,16,16,16,16,16,16,2,2,1,1,1,1,1,1,1,1,1,16,16,16,16,16,16,16,16,16,16,
+    16,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,16,16,16,16,1,1,1,1,1,1,1,2,2,16,1,1,
+    1,1,1,1,1,1,16,16,16,16,1,16,16,16,16,16,16,16,16,16,1,16,16,16,1,16,16,16,16,16,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,16,16,16,2,2,1,2,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,29,29,2,2,2,2,2,2,16,16,16,16,16,16,16,16,
+    1,1,1,1,1,1,1,1,1,1,16,16,16,16,16,16,16,16,29,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,33,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,16,33,16,1,33,33,
+    33,16,16,16,16,16,16,16,16,33,33,33,33,16,33,33,1,16,16,16,16,16,16,16,1,1,1,1,1,1,1,1,
+    1,1,16,16,1,1,1,1,1,1,1,1,1,1,1,1,1,16,33,33,2,1,1,1,1,1,1,1,1,2,2,1,
+    1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,
+    1,2,1,2,2,2,1,1,1,1,2,2,16,1,16,33,33,16,16,16,16,2,2,33,33,2,2,33,33,16,1,2,
+    2,2,2,2,2,2,2,16,2,2,2,2,1,1,2,1,1,1,16,16,2,2,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,16,2,2,16,16,33,2,1,1,1,1,1,1,2,2,2,2,1,
+    1,2,1,1,2,1,1,2,1,1,2,2,16,2,33,33,33,16,16,2,2,2,2,16,16,2,2,16,16,16,2,2,
+    2,16,2,2,2,2,2,2,2,1,1,1,1,2,1,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,
+    16,16,1,1,1,16,1,2,2,2,2,2,2,2,2,2,2,16,16,33,2,1,1,1,1,1,1,1,1,1,2,1,
+    1,2,1,1,2,1,1,1,1,1,2,2,16,1,33,33,33,16,16,16,16,16,2,16,16,33,2,33,33,16,2,2,
+    1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,2,2,2,2,2,2,2,1,16,16,16,16,16,16,
+    2,16,33,33,2,1,1,1,1,1,1,1,1,2,2,1,1,2,1,1,2,1,1,1,1,1,2,2,16,1,16,16,
+    33,16,16,16,16,2,2,33,33,2,2,33,33,16,2,2,2,2,2,2,2,16,16,16,2,2,2,2,1,1,2,1,
+    1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,16,1,2,1,1,1,1,1,1,2,2,2,1,1,
+    1,2,1,1,1,1,2,2,2,1,1,2,1,2,1,1,2,2,2,1,1,2,2,2,1,1,1,2,2,2,1,1,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,2,16,33,16,33,33,2,2,2,33,33,33,2,33,33,33,16,2,2,
+    1,2,2,2,2,2,2,16,2,2,2,2,2,2,2,2,16,33,33,33,16,1,1,1,1,1,1,1,1,2,1,1,
+    1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,16,1,16,16,
+    16,33,33,33,33,2,16,16,16,2,16,16,16,16,2,2,2,2,2,2,2,16,16,2,1,1,1,2,2,1,2,2,
+    2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,16,33,33,1,1,1,1,1,1,1,1,1,2,1,1,
+    1,1,1,1,2,1,1,1,1,1,2,2,16,1,33,16,33,33,16,33,33,2,16,33,33,2,33,33,16,16,2,2,
+    2,2,2,2,2,16,16,2,2,2,2,2,2,1,1,2,2,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    16,16,33,33,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,16,16,1,16,33,
+    33,16,16,16,16,2,33,33,33,2,33,33,33,16,29,1,2,2,2,2,1,1,1,16,1,1,1,1,1,1,1,1,
+    2,16,33,33,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,
+    1,1,2,1,1,1,1,1,1,1,1,1,2,1,2,2,1,1,1,1,1,1,1,2,2,2,16,2,2,2,2,16,
+    33,33,16,16,16,2,16,2,33,33,33,33,33,33,33,16,2,2,33,33,1,2,2,2,2,2,2,2,2,2,2,2,
+    1,16,1,33,16,16,16,16,16,16,16,2,2,2,2,1,1,1,1,1,1,1,1,16,16,16,16,16,16,16,16,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,1,1,2,1,2,1,1,1,1,1,2,1,1,1,1,1,1,1,1,2,1,2,1,1,1,1,1,1,1,1,1,
+    1,16,1,33,16,16,16,16,16,16,16,16,16,1,2,2,1,1,1,1,1,2,1,2,16,16,16,16,16,16,2,2,
+    1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,16,16,1,1,1,1,1,1,
+    1,1,1,1,1,16,1,16,1,16,1,1,1,1,33,33,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,16,16,16,16,16,16,16,16,16,16,16,16,16,16,33,
+    16,16,16,16,16,1,16,16,1,1,1,1,1,16,16,16,16,16,16,16,16,16,16,16,2,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,2,1,1,1,1,1,1,1,1,16,1,1,1,1,1,1,2,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,33,33,16,16,16,16,33,16,16,16,16,16,16,33,16,16,33,33,16,16,1,
+    1,1,1,1,1,1,33,33,16,16,1,1,1,1,16,16,16,1,33,33,33,1,1,33,33,33,33,33,33,33,1,1,
+    1,16,16,16,16,1,1,1,1,1,1,1,1,1,1,1,1,1,16,33,33,16,16,33,33,33,33,33,33,16,1,33,
+    1,1,1,1,1,1,1,1,1,1,33,33,33,16,1,1,1,1,1,1,1,1,2,1,2,2,2,2,2,1,2,2,
+    38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+    40,40,40,40,40,40,40,40,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+    1,1,1,1,1,1,1,1,1,2,1,1,1,1,2,2,1,1,1,1,1,1,1,2,1,2,1,1,1,1,2,2,
+    1,2,1,1,1,1,2,2,1,1,1,1,1,1,1,2,1,2,1,1,1,1,2,2,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,16,16,16,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,2,
+    1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,1,16,16,16,33,2,2,2,2,2,2,2,2,2,1,
+    1,1,16,16,33,1,1,2,2,2,2,2,2,2,2,2,1,1,16,16,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,2,16,16,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,16,16,33,16,16,16,16,16,16,16,33,33,33,33,33,33,33,33,16,33,33,16,16,16,16,16,16,16,
+    16,16,16,16,1,1,1,1,1,1,1,1,1,16,2,2,1,1,1,1,1,1,1,1,1,1,1,16,16,16,12,16,
+    1,1,1,1,1,16,16,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,16,1,2,2,2,2,2,
+    1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,16,16,16,33,33,33,33,16,16,33,33,33,2,2,2,2,
+    33,33,16,33,33,33,33,33,33,16,16,16,2,2,2,2,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,
+    1,1,1,1,1,1,1,16,16,33,33,16,2,2,1,1,1,1,1,1,1,33,16,33,16,16,16,16,16,16,16,2,
+    16,33,16,33,33,16,16,16,16,16,16,16,16,33,33,33,33,33,33,16,16,16,16,16,16,16,16,16,16,2,2,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,2,16,16,16,16,33,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,16,16,16,16,16,16,16,33,16,33,33,33,33,33,16,33,33,1,1,1,1,1,1,1,1,2,2,2,
+    16,16,16,16,1,1,1,1,1,1,1,1,1,1,1,2,16,16,33,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,33,16,16,16,16,33,33,16,16,33,16,16,16,1,1,1,1,1,1,1,1,16,33,16,16,33,33,33,16,33,16,
+    16,16,33,33,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,33,33,33,33,33,33,33,33,16,16,16,16,
+    16,16,16,16,33,33,16,16,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,
+    16,16,16,1,16,16,16,16,16,16,16,16,16,16,16,16,16,33,16,16,16,16,16,16,16,1,1,1,1,16,1,1,
+    1,1,1,1,16,1,1,33,16,16,1,2,2,2,2,2,1,1,1,1,1,1,1,1,2,1,2,1,2,1,2,1,
+    1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,1,1,1,
+    2,2,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,12,16,20,12,12,
+    1,1,1,1,1,1,1,1,12,12,12,12,12,12,12,1,1,1,1,1,1,1,1,1,1,1,1,1,57,1,1,1,
+    1,1,1,1,1,1,1,1,1,57,1,1,1,1,1,1,12,12,12,12,12,2,12,12,12,12,12,12,12,12,12,12,
+    1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,16,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,57,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,57,57,57,57,57,57,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,57,57,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,58,58,1,1,1,1,
+    1,1,1,1,1,1,1,1,57,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,57,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,57,1,1,1,1,1,1,1,1,1,58,58,58,58,57,57,57,
+    58,57,57,58,1,1,1,1,57,57,57,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,57,57,1,1,1,1,1,1,1,1,1,1,57,1,1,1,1,1,1,1,1,1,
+    57,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,57,57,58,58,1,
+    57,57,57,57,57,57,1,57,57,57,57,57,57,57,57,57,57,57,57,1,58,58,57,57,57,57,57,57,57,57,57,57,
+    57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,58,58,58,58,58,58,58,58,
+    58,58,58,58,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,58,
+    57,57,57,57,57,57,1,1,1,1,1,1,1,1,1,1,57,57,57,58,57,57,57,57,57,57,57,57,57,57,57,57,
+    57,58,57,57,57,57,57,57,57,57,58,58,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,58,58,57,
+    57,57,57,57,58,58,57,57,57,57,57,57,57,57,58,57,57,57,57,57,58,57,57,57,57,57,57,57,57,57,57,57,
+    57,57,57,57,57,57,57,57,57,57,58,57,57,57,57,57,57,57,58,58,57,58,57,57,57,57,58,57,57,58,57,57,
+    57,57,57,57,57,58,1,1,57,57,58,58,57,57,57,57,57,57,57,1,57,1,57,1,1,1,1,1,1,57,1,1,
+    1,57,1,1,1,1,1,1,58,1,1,1,1,1,1,1,1,1,1,57,57,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,57,1,1,57,1,1,1,1,58,1,58,1,1,1,1,58,58,58,1,58,1,1,1,1,1,1,1,1,
+    1,1,1,57,57,57,57,57,1,1,1,1,1,1,1,1,1,1,1,1,1,58,58,58,1,1,1,1,1,1,1,1,
+    1,57,1,1,1,1,1,1,1,1,1,1,1,1,1,1,58,1,1,1,1,1,1,1,1,1,1,1,1,1,1,58,
+    1,1,1,1,57,57,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,57,57,57,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,58,58,1,1,1,58,1,1,1,1,58,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,16,16,16,1,1,2,2,2,2,2,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,16,
+    1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,16,16,16,16,16,16,
+    58,2,2,2,2,2,2,2,2,2,2,2,2,58,2,1,2,2,2,2,2,2,2,2,2,16,16,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,58,2,58,2,2,2,2,2,2,
+    16,16,16,1,16,16,16,16,16,16,16,16,16,16,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,16,16,
+    16,16,1,1,1,1,1,1,2,2,2,2,2,2,2,2,1,1,2,1,2,1,1,1,1,1,2,2,2,2,2,2,
+    2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,16,1,1,1,16,1,1,1,1,16,1,1,1,1,
+    1,1,1,33,33,16,16,33,1,1,1,1,16,2,2,2,33,33,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,16,16,2,2,2,2,2,2,2,2,1,1,
+    16,16,1,1,1,1,1,1,1,1,1,1,1,1,1,16,1,1,1,1,1,1,16,16,16,16,16,16,16,16,1,1,
+    1,1,1,1,1,1,1,16,16,16,16,16,16,16,16,16,16,16,33,33,2,2,2,2,2,2,2,2,2,2,2,1,
+    38,38,38,38,38,38,38,38,38,38,38,38,38,2,2,2,1,1,1,16,33,33,16,16,16,16,33,33,16,16,33,33,
+    33,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,
+    1,1,1,1,1,16,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,16,16,16,16,16,16,33,
+    33,16,16,33,33,16,16,2,2,2,2,2,2,2,2,2,1,1,1,16,1,1,1,1,1,1,1,1,16,33,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,33,16,33,1,1,16,1,16,16,16,1,1,16,16,1,1,1,1,1,16,16,
+    1,16,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,33,16,16,33,33,1,1,1,1,1,33,16,2,2,2,2,2,2,2,2,2,
+    2,1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,
+    1,1,1,33,33,16,33,33,16,33,33,1,33,16,2,2,50,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+    54,54,54,54,54,54,54,54,54,54,54,54,50,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+    54,54,54,54,54,54,54,54,50,54,54,54,54,54,54,54,54,54,54,54,50,54,54,54,54,54,54,54,54,54,54,54,
+    54,54,54,54,2,2,2,2,2,2,2,2,2,2,2,2,40,40,40,40,40,40,40,0,0,0,0,44,44,44,44,44,
+    44,44,44,44,44,44,44,44,44,44,44,44,0,0,0,0,2,2,2,1,1,1,1,1,2,2,2,2,2,1,16,1,
+    1,1,1,1,1,1,1,2,1,1,1,1,1,2,1,2,1,1,2,1,1,2,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,12,2,2,1,1,1,1,1,1,2,2,1,1,1,1,1,1,
+    2,2,1,1,1,1,1,1,2,2,1,1,1,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,2,
+    2,2,2,2,2,2,2,2,2,12,12,12,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,2,1,1,2,1,1,1,1,2,2,2,2,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,16,2,2,
+    1,1,1,1,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,16,16,16,16,16,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,2,2,2,2,1,1,1,1,1,1,1,1,
+    1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,
+    1,1,1,2,1,1,2,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,2,2,2,
+    1,2,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,1,1,1,1,1,2,2,1,2,1,1,1,1,1,1,
+    1,1,1,1,1,1,2,1,1,2,2,2,1,2,2,1,1,1,1,2,1,1,2,2,2,2,2,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,
+    1,1,1,1,1,1,1,1,2,2,2,2,1,1,1,1,1,16,16,16,2,16,16,2,2,2,2,2,16,16,16,16,
+    1,1,1,1,2,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,16,16,16,2,2,2,2,16,
+    1,1,1,1,1,16,16,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,1,1,1,1,1,1,1,
+    1,1,2,2,2,2,2,2,2,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,
+    1,1,1,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,16,16,16,16,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,2,16,16,1,2,2,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    16,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,1,1,16,16,16,16,1,1,1,1,2,2,2,2,2,2,
+    33,16,33,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,1,1,1,1,1,1,1,2,2,16,1,1,16,16,1,2,2,2,2,2,2,2,2,2,16,
+    33,33,33,16,16,16,16,33,33,16,16,1,1,29,1,1,1,1,16,2,2,2,2,2,2,2,2,2,2,29,2,2,
+    16,16,16,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,16,16,16,16,16,33,16,16,16,
+    16,16,16,16,16,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,33,33,1,2,2,2,2,2,2,2,2,
+    1,1,1,16,1,1,1,2,2,2,2,2,2,2,2,2,1,1,1,33,33,33,16,16,16,16,16,16,16,16,16,33,
+    33,1,29,29,1,1,1,1,1,16,16,16,16,1,33,16,1,1,1,1,1,1,1,1,1,1,1,1,33,33,33,16,
+    16,16,33,33,16,33,16,16,1,1,1,1,1,1,16,2,1,1,1,1,1,1,1,2,1,2,1,1,1,1,2,1,
+    33,33,33,16,16,16,16,16,16,16,16,2,2,2,2,2,16,16,33,33,2,1,1,1,1,1,1,1,1,2,2,1,
+    1,2,1,1,2,1,1,1,1,1,2,16,16,1,16,33,16,33,33,33,33,2,2,33,33,2,2,33,33,33,2,2,
+    1,2,2,2,2,2,2,16,2,2,2,2,2,1,1,1,1,1,33,33,2,2,16,16,16,16,16,16,16,2,2,2,
+    16,16,16,16,16,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,33,33,33,16,16,16,16,16,16,16,16,
+    33,33,16,16,16,33,16,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,16,1,
+    16,33,33,16,16,16,16,16,16,33,16,33,33,16,33,16,16,33,16,16,1,1,1,1,2,2,2,2,2,2,2,2,
+    33,33,16,16,16,16,2,2,33,33,33,33,16,16,33,16,1,1,1,1,1,1,1,1,1,1,1,1,16,16,2,2,
+    33,33,33,16,16,16,16,16,16,16,16,33,33,16,33,16,16,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,16,33,16,33,33,16,16,16,16,16,16,33,16,1,1,2,2,2,2,2,2,
+    33,33,16,16,16,16,33,16,16,16,16,16,2,2,2,2,16,16,16,16,16,16,16,16,33,16,16,1,2,2,2,2,
+    1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,2,1,2,2,1,1,1,1,
+    1,1,1,1,2,1,1,2,1,1,1,1,1,1,1,1,16,33,33,33,33,33,2,33,33,2,2,16,16,33,16,29,
+    33,29,33,16,1,1,1,2,2,2,2,2,2,2,2,2,1,33,33,33,16,16,16,16,2,2,16,16,33,33,33,33,
+    16,1,1,1,33,2,2,2,2,2,2,2,2,2,2,2,1,16,16,16,16,16,16,16,16,16,16,1,1,1,1,1,
+    1,1,1,16,16,16,16,16,16,33,29,16,16,16,16,1,1,1,1,1,1,1,1,16,2,2,2,2,2,2,2,2,
+    1,16,16,16,16,16,16,33,33,16,16,16,1,1,1,1,1,1,1,1,29,29,29,29,29,29,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,33,16,16,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,33,
+    16,16,16,16,16,16,16,2,16,16,16,16,16,16,33,16,2,2,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,2,33,16,16,16,16,16,16,16,33,16,16,33,16,16,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,2,1,1,2,1,1,1,1,1,1,16,16,16,16,16,16,2,2,2,16,2,16,16,2,16,
+    16,16,16,16,16,16,29,16,2,2,2,2,2,2,2,2,1,1,1,1,1,1,2,1,1,2,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,33,33,33,33,33,2,16,16,2,33,33,16,33,16,1,2,2,2,2,2,2,2,
+    1,1,1,16,16,33,33,1,1,2,2,2,2,2,2,2,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+    1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,12,12,12,12,12,12,12,12,12,2,2,2,2,2,2,2,
+    16,16,16,16,16,1,2,2,2,2,2,2,2,2,2,2,16,16,16,16,16,16,16,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,16,1,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+    33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,2,2,2,2,2,2,2,16,
+    2,2,2,2,16,2,2,2,2,2,2,2,2,2,2,2,34,34,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,2,2,1,16,16,1,12,12,12,12,2,2,2,2,2,2,2,2,2,2,2,2,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,2,2,16,16,16,16,16,16,16,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,16,33,16,16,16,1,1,1,33,16,16,16,16,16,12,12,12,12,12,12,12,12,16,16,16,16,16,
+    16,16,16,1,1,16,16,16,16,16,16,16,1,1,1,1,1,1,1,1,1,1,1,1,1,1,16,16,16,16,1,1,
+    1,1,16,16,16,1,2,2,2,2,2,2,2,2,2,2,2,2,1,2,2,1,1,2,2,1,1,1,1,2,1,1,
+    1,1,1,1,1,1,1,1,1,1,2,1,2,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,2,1,1,1,1,2,2,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,
+    1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,2,1,1,1,1,1,2,1,2,2,2,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,16,16,16,16,16,16,16,1,1,1,1,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,1,1,1,1,1,1,1,16,1,1,1,1,1,1,1,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,16,16,16,16,16,16,16,16,16,16,16,16,2,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,2,2,16,16,16,16,16,16,16,2,16,16,2,16,16,16,16,16,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,16,16,16,16,1,1,1,1,1,1,1,2,1,1,1,1,2,1,1,2,
+    1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,16,16,16,16,16,16,16,1,2,2,2,2,
+    2,1,1,2,1,2,2,1,2,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,2,1,2,1,2,2,2,2,
+    2,2,1,2,2,2,2,1,2,1,2,1,2,1,1,1,2,1,1,2,1,2,2,1,2,1,2,1,2,1,2,1,
+    2,1,1,2,1,2,2,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,1,1,2,1,1,1,1,2,1,2,
+    2,1,1,1,2,1,1,1,1,1,2,1,1,1,1,1,57,57,57,57,57,57,57,57,57,57,57,57,58,58,58,58,
+    57,57,57,57,58,58,58,58,58,58,58,58,58,58,58,58,58,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,
+    58,57,57,57,57,57,57,57,57,57,57,57,57,57,57,58,57,57,57,57,57,57,58,58,58,58,58,58,58,58,58,58,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,57,57,57,1,1,1,1,1,1,1,1,1,1,1,1,57,57,57,57,
+    57,57,1,1,1,1,1,1,1,1,1,1,1,1,57,57,1,1,1,1,1,1,1,1,1,1,1,1,1,1,58,1,
+    1,58,58,58,58,58,58,58,58,58,58,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,57,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,25,25,25,25,25,25,25,25,25,25,
+    25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,2,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    2,2,2,2,2,2,2,2,2,2,58,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,58,
+    2,2,58,58,58,58,58,58,58,58,58,2,58,58,58,58,2,2,2,2,2,2,2,2,2,58,58,58,58,58,58,58,
+    58,57,57,57,57,57,57,57,57,57,57,57,57,58,58,58,58,58,58,58,58,58,57,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,57,58,58,58,58,58,58,58,58,58,58,58,58,58,57,57,57,57,58,
+    58,57,57,57,58,57,57,57,58,58,58,16,16,16,16,16,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,57,
+    58,57,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,57,57,58,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,1,1,1,1,1,1,1,1,57,57,57,57,57,58,58,58,58,57,
+    58,58,58,58,58,58,58,58,57,57,57,57,57,57,57,57,57,57,57,57,57,58,58,57,57,57,57,57,57,57,57,57,
+    57,57,57,57,57,57,57,57,57,57,57,58,58,58,58,58,58,58,58,58,58,58,57,57,57,57,57,57,58,57,57,57,
+    58,58,58,57,57,58,58,58,58,58,58,58,58,58,58,58,1,1,1,1,58,58,58,58,58,58,58,58,58,58,58,58,
+    1,1,1,1,1,57,57,57,57,58,58,58,58,58,58,58,1,1,1,1,1,1,1,1,1,1,1,1,58,58,58,58,
+    1,1,1,1,1,1,1,1,58,58,58,58,58,58,58,58,1,1,1,1,1,1,1,1,1,1,58,58,58,58,58,58,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,58,58,57,57,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+    58,58,58,58,58,58,58,58,58,58,58,1,58,58,58,58,58,58,58,58,58,58,1,58,58,58,58,58,58,58,58,58,
+    57,57,57,57,57,57,57,57,57,57,57,57,57,57,58,58,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,
+    58,58,58,58,58,58,58,58,58,58,58,58,58,58,2,2,2,12,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+};
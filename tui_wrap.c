@@ -0,0 +1,209 @@
+#include "tui_wrap.h"
+#include <stdlib.h>
+#include <string.h>
+#include "tui_alloc.h"
+
+struct TUI_Wrap {
+    int       cap;
+    int       step;            /* highest power of two <= cap */
+    int64_t   first, end;      /* lines kept: [first, end) */
+    int       width;
+    uint32_t  gen;             /* bumped by every width change */
+    int64_t   sweep;           /* lines below may still be stale */
+    TUI_WrapMeasure measure;
+    void     *user;
+
+    /* per ring slot */
+    int32_t  *len;
+    int32_t  *rows;            /* as counted in the tree */
+    uint32_t *gens;            /* width generation rows belongs to */
+    uint64_t *tree;            /* Fenwick tree of rows, 1-based */
+};
+
+/* ── Fenwick tree ──────────────────────────────────────── */
+
+static void tree_add(TUI_Wrap *w, int slot, int64_t d)
+{
+    for (int i = slot + 1; i <= w->cap; i += i & -i)
+        w->tree[i] += (uint64_t)d;
+}
+
+/* rows of slots [0, k) */
+static uint64_t tree_sum(const TUI_Wrap *w, int k)
+{
+    uint64_t s = 0;
+    for (int i = k; i > 0; i -= i & -i) s += w->tree[i];
+    return s;
+}
+
+/* the slot holding row `target` counted from slot 0 */
+static int tree_find(const TUI_Wrap *w, uint64_t target)
+{
+    int pos = 0;
+    for (int step = w->step; step > 0; step >>= 1) {
+        if (pos + step <= w->cap && w->tree[pos + step] <= target) {
+            pos    += step;
+            target -= w->tree[pos];
+        }
+    }
+    return pos;
+}
+
+/* ── Lines ─────────────────────────────────────────────── */
+
+static int slot_of(const TUI_Wrap *w, int64_t line)
+{
+    return (int)(line % w->cap);
+}
+
+static int rows_for(const TUI_Wrap *w, int64_t line)
+{
+    if (w->width <= 0) return 1;
+    if (w->measure) {
+        int rows = w->measure(w->user, line, w->width);
+        return rows > 0 ? rows : 1;
+    }
+    int len = w->len[slot_of(w, line)];
+    if (len <= 0) return 1;
+    return (len + w->width - 1) / w->width;
+}
+
+static void set_rows(TUI_Wrap *w, int s, int rows)
+{
+    if (rows != w->rows[s]) tree_add(w, s, rows - w->rows[s]);
+    w->rows[s] = rows;
+    w->gens[s] = w->gen;
+}
+
+static void refresh(TUI_Wrap *w, int64_t line)
+{
+    int s = slot_of(w, line);
+    if (w->gens[s] != w->gen) set_rows(w, s, rows_for(w, line));
+}
+
+/* ── API ───────────────────────────────────────────────── */
+
+TUI_Wrap *tui_wrap_new(int capacity)
+{
+    if (capacity < 1) capacity = 1;
+    TUI_Wrap *w = calloc(1, sizeof *w);
+    if (!w) return NULL;
+    w->cap  = capacity;
+    w->len  = calloc((size_t)capacity, sizeof *w->len);
+    w->rows = calloc((size_t)capacity, sizeof *w->rows);
+    w->gens = calloc((size_t)capacity, sizeof *w->gens);
+    w->tree = calloc((size_t)capacity + 1, sizeof *w->tree);
+    if (!w->len || !w->rows || !w->gens || !w->tree) {
+        tui_wrap_free(w);
+        return NULL;
+    }
+    for (w->step = 1; w->step * 2 <= capacity; w->step *= 2) {}
+    return w;
+}
+
+void tui_wrap_free(TUI_Wrap *w)
+{
+    if (!w) return;
+    free(w->len);
+    free(w->rows);
+    free(w->gens);
+    free(w->tree);
+    free(w);
+}
+
+void tui_wrap_clear(TUI_Wrap *w)
+{
+    size_t n = (size_t)w->cap;
+    memset(w->len,  0, n * sizeof *w->len);
+    memset(w->rows, 0, n * sizeof *w->rows);
+    memset(w->tree, 0, (n + 1) * sizeof *w->tree);
+    w->first = w->sweep = w->end;    /* numbering goes on */
+}
+
+void tui_wrap_measure(TUI_Wrap *w, TUI_WrapMeasure fn, void *user)
+{
+    w->measure = fn;
+    w->user    = user;
+    w->gen++;                        /* rows counted so far may differ */
+    w->sweep = w->end;
+}
+
+int64_t tui_wrap_push(TUI_Wrap *w, int len)
+{
+    int64_t line = w->end++;
+    if (w->end - w->first > w->cap) w->first++;     /* reuses its slot */
+    int s = slot_of(w, line);
+    w->len[s] = len;
+    set_rows(w, s, rows_for(w, line));
+    return line;
+}
+
+int64_t tui_wrap_first(const TUI_Wrap *w) { return w->first; }
+int64_t tui_wrap_end  (const TUI_Wrap *w) { return w->end; }
+
+void tui_wrap_set_width(TUI_Wrap *w, int width)
+{
+    if (width == w->width) return;
+    w->width = width;
+    w->gen++;
+    w->sweep = w->end;
+}
+
+int64_t tui_wrap_reflow(TUI_Wrap *w, int64_t from, int64_t to, int budget)
+{
+    if (from < w->first) from = w->first;
+    if (to > w->end)     to   = w->end;
+    for (int64_t l = from; l < to; l++) refresh(w, l);
+
+    if (w->sweep < w->first) w->sweep = w->first;
+    while (budget > 0 && w->sweep > w->first) {
+        int s = slot_of(w, --w->sweep);
+        if (w->gens[s] == w->gen) continue;
+        set_rows(w, s, rows_for(w, w->sweep));
+        budget--;
+    }
+    return w->sweep - w->first;
+}
+
+int tui_wrap_line_rows(TUI_Wrap *w, int64_t line)
+{
+    if (line < w->first || line >= w->end) return 0;
+    refresh(w, line);
+    return w->rows[slot_of(w, line)];
+}
+
+uint64_t tui_wrap_rows(const TUI_Wrap *w)
+{
+    return tree_sum(w, w->cap);
+}
+
+/* the ring holds the oldest line at slot s0, so rows are counted from
+   there to the end of the ring and then on from slot 0 */
+uint64_t tui_wrap_row_of(const TUI_Wrap *w, int64_t line)
+{
+    if (line <= w->first) return 0;
+    if (line >= w->end)   return tui_wrap_rows(w);
+    int s0 = slot_of(w, w->first), s = slot_of(w, line);
+    uint64_t before = tree_sum(w, s0);
+    if (s >= s0) return tree_sum(w, s) - before;
+    return tui_wrap_rows(w) - before + tree_sum(w, s);
+}
+
+int64_t tui_wrap_line_at(const TUI_Wrap *w, uint64_t row, int *sub)
+{
+    if (sub) *sub = 0;
+    uint64_t total = tui_wrap_rows(w);
+    if (w->end == w->first || total == 0) return w->first;
+    if (row >= total) row = total - 1;
+
+    int s0 = slot_of(w, w->first);
+    uint64_t before = tree_sum(w, s0);
+    uint64_t head   = total - before;        /* rows in slots s0 .. cap-1 */
+    int64_t line;
+    if (row < head)
+        line = w->first + (tree_find(w, before + row) - s0);
+    else
+        line = w->first + (w->cap - s0) + tree_find(w, row - head);
+    if (sub) *sub = (int)(row - tui_wrap_row_of(w, line));
+    return line;
+}
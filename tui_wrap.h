@@ -0,0 +1,53 @@
+#ifndef TUI_WRAP_H
+#define TUI_WRAP_H
+
+#include "tui.h"
+
+/*
+ * Soft-wrap index for a scrollback of lines.
+ *
+ * Lines are numbered from 0 as they are pushed and the oldest are dropped
+ * once `capacity` lines are kept.  The index does not hold the text: a
+ * measure callback tells how many rows a line takes at a width.  Without
+ * one, each line's pushed length counts as cells and at width W a line
+ * takes max(1, ceil(len / W)) rows.  The row counts are kept in a Fenwick
+ * tree over the ring, so the first row of a line and the line at a row are
+ * found in O(log n).
+ *
+ * Changing the width does not reflow anything by itself.  Until a line is
+ * refreshed the tree keeps its row count for an older width.
+ * tui_wrap_reflow() refreshes the lines the caller is about to draw
+ * exactly, then a budget of the remaining stale lines, newest first.
+ * Positions far from the view are estimates until the sweep has passed
+ * them, so a view should be anchored to a line, not to a row.
+ */
+
+typedef struct TUI_Wrap TUI_Wrap;
+
+/* rows line takes at width, at least 1 */
+typedef int (*TUI_WrapMeasure)(void *user, int64_t line, int width);
+
+TUI_Wrap *tui_wrap_new  (int capacity);
+void      tui_wrap_free (TUI_Wrap *w);
+void      tui_wrap_clear(TUI_Wrap *w);      /* numbers are not reused */
+/* set before pushing; the text of line tui_wrap_end() must be measurable
+   when it is pushed */
+void      tui_wrap_measure(TUI_Wrap *w, TUI_WrapMeasure fn, void *user);
+
+/* appends a line of len cells and returns its number */
+int64_t   tui_wrap_push (TUI_Wrap *w, int len);
+int64_t   tui_wrap_first(const TUI_Wrap *w);    /* oldest line kept */
+int64_t   tui_wrap_end  (const TUI_Wrap *w);    /* one past the newest */
+
+void      tui_wrap_set_width(TUI_Wrap *w, int width);
+/* makes lines [from, to) exact, then up to budget stale lines elsewhere;
+   returns how many lines may still be stale */
+int64_t   tui_wrap_reflow(TUI_Wrap *w, int64_t from, int64_t to, int budget);
+
+int       tui_wrap_line_rows(TUI_Wrap *w, int64_t line);   /* exact */
+uint64_t  tui_wrap_rows     (const TUI_Wrap *w);
+uint64_t  tui_wrap_row_of   (const TUI_Wrap *w, int64_t line);
+/* the line holding row (clamped), and the row within it */
+int64_t   tui_wrap_line_at  (const TUI_Wrap *w, uint64_t row, int *sub);
+
+#endif /* TUI_WRAP_H */